@@ -28,5 +28,9 @@
 
 #define COMPLEX_VERSION "1.4"
 
-Gua_Status Complex_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Complex_AbsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Complex_ArgFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Complex_ConjFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Complex_ImagFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Complex_RealFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Complex_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error);
@@ -44,6 +44,22 @@ void Fs_Path(Gua_String file, Gua_String *path);
 Gua_Status Fs_Rename(Gua_String source, Gua_String target, Gua_String error);
 Gua_Integer Fs_Size(Gua_String file);
 Gua_Real Fs_Time(Gua_String file);
-Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsCopyFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsDeleteFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsExistsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsExtensionFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsFullPathFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsIsDirectoryFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsIsExecutableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsIsReadableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsIsWritableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsLinkFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsMkDirFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsNameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsPathFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsRenameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Fs_FsTimeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Fs_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error);
 
@@ -28,6 +28,6 @@
 
 #define GUA_GLF_VERSION "1.0"
 
-Gua_Status Glf_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glf_GlfDrawTextFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Glf_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error);
 
@@ -30,6 +30,8 @@
 
 Gua_String Glo_LoadPPM(Gua_String file, Gua_Short *width, Gua_Short *height);
 Gua_Status Glo_SavePPM(Gua_String file, Gua_String image, Gua_Short width, Gua_Short height);
-Gua_Status Glo_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glo_GloLoadObjFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glo_GloLoadPPMFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glo_GloSavePPMFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Glo_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error);
 
@@ -28,6 +28,8 @@
 
 #define GUA_GLU_VERSION "1.0"
 
-Gua_Status Glu_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glu_GluLookAtFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glu_GluOrtho2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glu_GluPerspectiveFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Glu_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error);
 
@@ -30,6 +30,8 @@
 
 Gua_String Glutil_LoadPPM(Gua_String file, Gua_Short *width, Gua_Short *height);
 Gua_Status Glutil_SavePPM(Gua_String file, Gua_String image, Gua_Short width, Gua_Short height);
-Gua_Status Glutil_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glutil_GlutilLoadObjFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glutil_GlutilLoadPPMFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Glutil_GlutilSavePPMFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Glutil_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error);
 
@@ -140,6 +140,35 @@
 #define FUNCTION_TYPE_SCRIPT   1
 #define FUNCTION_TYPE_UNKNOWN  2
 
+#define OPCODE_NULL         0
+#define OPCODE_CONSTANT     1
+#define OPCODE_STRING       2
+#define OPCODE_STATEMENT    3
+#define OPCODE_LOAD         4
+#define OPCODE_LOAD_INDEX   5
+#define OPCODE_CALLABLE     6
+#define OPCODE_CALL         7
+#define OPCODE_ARRAY        8
+#define OPCODE_MATRIX       9
+#define OPCODE_BINARY      10
+#define OPCODE_UNARY       11
+#define OPCODE_STORE       12
+#define OPCODE_STORE_INDEX 13
+#define OPCODE_JUMP        14
+#define OPCODE_JUMP_FALSE  15
+#define OPCODE_EVALUATE    16
+#define OPCODE_REPLACE     17
+#define OPCODE_ITERATE     18
+#define OPCODE_NEXT        19
+#define OPCODE_SHORT_CIRCUIT 20
+#define OPCODE_APPEND      21
+
+/* The operand types seen by an OPCODE_BINARY instruction, kept in its b field. */
+#define BINARY_SITE_UNSEEN   0
+#define BINARY_SITE_INTEGER  1
+#define BINARY_SITE_REAL     2
+#define BINARY_SITE_GENERIC  3
+
 /* Error codes. */
 #define GUA_OK                          0
 #define GUA_CONTINUE                    1
@@ -189,8 +218,28 @@
 #define ZERO     EPSILON
 
 #define MAX_ERROR_MSG_SIZE  1024
+#define ERROR_BUFFER_SIZE   65536
 
 #define NAMESPACE_HASH_SIZE  32
+#define ATOM_TABLE_SIZE      256
+#define ARRAY_HASH_SIZE      16
+#define KEYWORD_HASH_SIZE    20
+
+#define MATCH_TABLE_MIN_SIZE  256
+
+#define MAX_CALL_DEPTH  200000
+
+#define PROFILE_RATE         1000
+#define PROFILE_STACK_DEPTH  256
+
+#define MEMORY_TYPE_OTHER      0
+#define MEMORY_TYPE_STRING     1
+#define MEMORY_TYPE_ELEMENT    2
+#define MEMORY_TYPE_MATRIX     3
+#define MEMORY_TYPE_NAMESPACE  4
+#define MEMORY_TYPES           5
+
+#define MEMORY_SIZE_CLASSES  14
 
 typedef int Gua_Type;
 typedef int Gua_Short;
@@ -213,6 +262,11 @@ typedef struct {
     Gua_Status status;
 } Gua_Token;
 
+typedef struct {
+    Gua_String lexeme;
+    Gua_Type type;
+} Gua_Keyword;
+
 typedef struct {
     Gua_String description;
     Gua_String symbol;
@@ -220,30 +274,47 @@ typedef struct {
 
 typedef struct {
     Gua_Type type;
-    Gua_Integer integer;
-    Gua_Real real;
-    Gua_Imaginary imaginary;
-    Gua_String string;
-    struct Gua_Element *array;
-    struct Gua_Matrix *matrix;
-    struct Gua_File *file;
-    struct Gua_Handle *handle;
-    struct Gua_Namespace *nspace;
-    Gua_Length length;
     Gua_Stored stored;
+    union {
+        Gua_Integer integer;
+        Gua_Real real;
+        Gua_String string;
+        struct Gua_Array *array;
+        struct Gua_Element *element;
+        struct Gua_Matrix *matrix;
+        struct Gua_File *file;
+        struct Gua_Handle *handle;
+        struct Gua_Namespace *nspace;
+    };
+    union {
+        Gua_Imaginary imaginary;
+        Gua_Length length;
+    };
 } Gua_Object;
 
 typedef struct {
     Gua_Object key;
     Gua_Object object;
+    unsigned long hash;
     struct Gua_Element *previous;
     struct Gua_Element *next;
 } Gua_Element;
 
+typedef struct {
+    struct Gua_Element *first;
+    struct Gua_Element *last;
+    struct Gua_Element **index;
+    Gua_Short dense;
+    Gua_Integer elements;
+    Gua_Integer indexSize;
+    Gua_Integer references;
+} Gua_Array;
+
 typedef struct {
     Gua_Short dimc;
     Gua_Integer *dimv;
     struct Gua_Object *object;
+    Gua_Integer references;
 } Gua_Matrix;
 
 typedef struct {
@@ -271,8 +342,6 @@ typedef struct {
 typedef struct {
     Gua_String name;
     Gua_Object object;
-    struct Gua_Variable *previous;
-    struct Gua_Variable *next;
 } Gua_Variable;
 
 typedef struct {
@@ -286,18 +355,188 @@ typedef struct {
     Gua_Short argc;
     struct Gua_Argument *argv;
     Gua_String script;
+    Gua_Integer line;
+    struct Gua_Code *code;
     Gua_Short (*pointer)(void *, Gua_Short, Gua_Object *, Gua_Object *, Gua_String);
-    struct Gua_Function *previous;
-    struct Gua_Function *next;
+    Gua_String types;
 } Gua_Function;
 
 typedef struct {
-    Gua_Variable *variable[NAMESPACE_HASH_SIZE];
-    Gua_Function *function[NAMESPACE_HASH_SIZE];
+    Gua_String name;
+    Gua_Short (*pointer)(void *, Gua_Short, Gua_Object *, Gua_Object *, Gua_String);
+    Gua_Short argc;
+    Gua_String types;
+} Gua_FunctionEntry;
+
+typedef struct {
+    Gua_Variable **variable;
+    Gua_Integer variables;
+    Gua_Integer variablesSize;
+    Gua_Function **function;
+    Gua_Integer functions;
+    Gua_Integer functionsSize;
     struct Gua_Namespace *previous;
     struct Gua_Namespace *next;
+    struct Gua_Namespace *global;
 } Gua_Namespace;
 
+typedef struct {
+    Gua_String atom;
+    Gua_Integer count;
+} Gua_FrameSymbol;
+
+typedef struct {
+    Gua_Integer hits;
+    Gua_Integer misses;
+} Gua_PoolStatistics;
+
+typedef struct {
+    Gua_Integer live;
+    Gua_Integer peak;
+    Gua_Integer allocations;
+    Gua_Integer reallocations;
+    Gua_Integer frees;
+    Gua_Integer size[MEMORY_SIZE_CLASSES];
+    Gua_Integer type[MEMORY_TYPES];
+    Gua_Integer typeBytes[MEMORY_TYPES];
+} Gua_MemoryStatistics;
+
+typedef struct {
+    Gua_Short opcode;
+    Gua_Short a;
+    Gua_Integer b;
+} Gua_Instruction;
+
+typedef struct {
+    Gua_Integer first;
+    Gua_Integer last;
+    Gua_Integer start;
+    Gua_Length length;
+    Gua_Integer line;
+} Gua_Command;
+
+typedef struct {
+    Gua_Integer first;
+    Gua_Integer last;
+    Gua_Integer slot;
+    Gua_Integer keep;
+    Gua_Integer next;
+    Gua_Integer end;
+} Gua_Loop;
+
+typedef struct {
+    Gua_String atom;
+    Gua_Integer generation;
+    struct Gua_Namespace *nspace;
+    struct Gua_Function *function;
+} Gua_CallSite;
+
+typedef struct {
+    Gua_String source;
+    Gua_Integer line;
+    Gua_Integer scanned;
+    Gua_Integer scannedLine;
+    Gua_Instruction *instruction;
+    Gua_Integer length;
+    Gua_Integer size;
+    Gua_Object *constant;
+    Gua_Integer constants;
+    Gua_Integer constantsSize;
+    Gua_Command *command;
+    Gua_Integer commands;
+    Gua_Integer commandsSize;
+    Gua_Loop *loop;
+    Gua_Integer loops;
+    Gua_Integer loopsSize;
+    Gua_String *local;
+    Gua_Integer locals;
+    Gua_Integer localsSize;
+    Gua_CallSite *site;
+    Gua_Integer sites;
+    Gua_Integer depth;
+    Gua_Integer maxDepth;
+    struct Gua_TraceEntry **trace;
+    Gua_Integer references;
+} Gua_Code;
+
+typedef struct {
+    Gua_Namespace *nspace;
+    Gua_Code *code;
+    Gua_Object *stack;
+    Gua_Variable **slot;
+    Gua_Integer generation;
+    Gua_Integer sp;
+    Gua_Integer pc;
+} Gua_CallFrame;
+
+typedef struct Gua_TraceEntry {
+    Gua_String name;
+    Gua_Integer line;
+    unsigned long hash;
+    Gua_Integer count;
+    Gua_Real inclusive;
+    Gua_Real exclusive;
+    Gua_Integer allocations;
+    Gua_Integer active;
+} Gua_TraceEntry;
+
+typedef struct {
+    Gua_TraceEntry **entry;
+    Gua_Integer entries;
+    Gua_Integer size;
+} Gua_TraceTable;
+
+typedef struct {
+    Gua_String name;
+    Gua_String source;
+    Gua_Integer line;
+    Gua_Code *code;
+    Gua_Integer pc;
+    Gua_String position;
+    Gua_String native;
+    Gua_String base;
+    Gua_String end;
+    Gua_String scanned;
+    Gua_Integer scannedLine;
+    Gua_TraceEntry *function;
+    Gua_TraceEntry *statement;
+    Gua_Real called;
+    Gua_Real started;
+    Gua_Real children;
+    Gua_Real statementChildren;
+    Gua_Integer allocations;
+    Gua_Integer statementAllocations;
+} Gua_ProfileFrame;
+
+typedef struct {
+    Gua_String key;
+    unsigned long hash;
+    Gua_Integer self;
+    Gua_Integer total;
+    Gua_Integer mark;
+} Gua_ProfileEntry;
+
+typedef struct {
+    Gua_ProfileEntry *entry;
+    Gua_Integer entries;
+    Gua_Integer size;
+} Gua_ProfileTable;
+
+typedef struct Gua_CodeCacheEntry {
+    Gua_String source;
+    unsigned long hash;
+    Gua_Code *code;
+    struct Gua_CodeCacheEntry *previous;
+    struct Gua_CodeCacheEntry *next;
+} Gua_CodeCacheEntry;
+
+typedef struct Gua_MatchTable {
+    Gua_String start;
+    Gua_String end;
+    Gua_Length *match;
+    struct Gua_MatchTable *previous;
+} Gua_MatchTable;
+
 typedef struct timeval Gua_Time;
 
 /* 
@@ -331,19 +570,48 @@ typedef struct timeval Gua_Time;
 
 Gua_String Gua_ScanNumber(Gua_String start, Gua_Token *token);
 Gua_String Gua_ScanOperator(Gua_String start, Gua_Token *token);
+Gua_Type Gua_KeywordType(Gua_String start, Gua_Length length);
 Gua_String Gua_ScanIdentifier(Gua_Namespace *nspace, Gua_String start, Gua_Token *token);
 Gua_String Gua_ScanDoubleQuotes(Gua_String start, Gua_Token *token);
 Gua_String Gua_ScanString(Gua_String target, Gua_String source, Gua_Integer n);
 Gua_String Gua_ScanArgSeparator(Gua_String start, Gua_Token *token);
 Gua_String Gua_ScanSeparator(Gua_String start, Gua_Token *token);
 Gua_String Gua_ScanComment(Gua_String start, Gua_Token *token);
+void Gua_PushMatchTable(Gua_MatchTable *table, Gua_String start);
+void Gua_PopMatchTable(Gua_MatchTable *table);
+Gua_String Gua_MatchingCloser(Gua_String start);
 Gua_String Gua_ScanParenthesis(Gua_String start, Gua_Token *token);
 Gua_String Gua_ScanBracket(Gua_String start, Gua_Token *token);
 Gua_String Gua_ScanBrace(Gua_String start, Gua_Token *token);
 Gua_String Gua_NextToken(Gua_Namespace *nspace, Gua_String start, Gua_Token *token);
 
 /* Parser macros and functions. */
-Gua_Status Gua_BuiltInFunction(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ArrayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ArrayToStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_BreakFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ContinueFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_DimFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ErrorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_EvalFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ExistsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ExitFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ExprFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_GetMatrixElementFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_IdentFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_InvFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_IsMatrixApproximatelyEqualFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_KeysFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_LengthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_Matrix2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_MatrixToStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+void Gua_SetIntegerElement(Gua_Object *array, Gua_String name, Gua_Integer n);
+Gua_Status Gua_MemStatsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ReturnFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_SetMatrixElementFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ToStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_TypeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Gua_CountArguments(Gua_String start);
 Gua_Status Gua_ParseArguments(Gua_Namespace *nspace, Gua_String start, Gua_Short argc, Gua_Object *argv, Gua_Short first, Gua_Status *status, Gua_String error);
 Gua_Status Gua_CountCommands(Gua_String start);
@@ -351,7 +619,21 @@ Gua_Status Gua_ParseCommands(Gua_Namespace *nspace, Gua_String start, Gua_Short
 Gua_Status Gua_ParseFormalArguments(Gua_Namespace *nspace, Gua_String start, Gua_Short argc, Gua_Object *argv, Gua_Status *status, Gua_String error);
 Gua_Status Gua_CountMatrixElements(Gua_String start);
 Gua_Status Gua_ParseMatrixElements(Gua_Namespace *nspace, Gua_String start, Gua_Short argc, Gua_Object *argv, Gua_Status *status, Gua_String error);
+Gua_Object *Gua_AllocArguments(Gua_Short argc);
 void Gua_FreeArguments(Gua_Short argc, Gua_Object *argv);
+Gua_String Gua_AllocErrorBuffer(void);
+void Gua_FreeErrorBuffer(Gua_String error);
+void Gua_AddStatusMessage(Gua_Status status, Gua_String error);
+void Gua_GetPoolStatistics(Gua_PoolStatistics *elements, Gua_PoolStatistics *variables, Gua_PoolStatistics *arguments);
+Gua_Length Gua_BlockSize(void *block);
+Gua_Short Gua_SizeClass(Gua_Length size);
+void *Gua_CountAlloc(Gua_Length size, Gua_Short type);
+void *Gua_CountRealloc(void *block, Gua_Length size, Gua_Short type);
+void Gua_CountFree(void *block);
+void Gua_SetMemoryAccounting(Gua_Short accounting);
+Gua_Short Gua_GetMemoryAccounting(void);
+void Gua_GetMemoryStatistics(Gua_MemoryStatistics *statistics);
+void Gua_WriteMemoryStatistics(FILE *fp);
 Gua_String Gua_ParseIf(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
 Gua_String Gua_ParseWhile(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
 Gua_String Gua_ParseDo(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
@@ -367,6 +649,7 @@ Gua_String Gua_ParseAssignFunction(Gua_Namespace *nspace, Gua_String start, Gua_
 Gua_String Gua_ParseAssignUnknown(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
 Gua_String Gua_ParseAssignMacro(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
 Gua_String Gua_ParseAssignIndirection(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
+Gua_String Gua_SkipOperand(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Short level, Gua_Status *status);
 Gua_String Gua_ParseLogicOr(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
 Gua_String Gua_ParseLogicAnd(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
 Gua_String Gua_ParseBitOr(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
@@ -382,15 +665,91 @@ Gua_String Gua_ParsePower(Gua_Namespace *nspace, Gua_String start, Gua_Token *to
 Gua_String Gua_ParseUnaryPlus(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
 Gua_String Gua_ParseNot(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
 Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *token, Gua_Object *object, Gua_Status *status, Gua_String error);
+Gua_Status Gua_UnaryOperator(Gua_Short op, Gua_Object *operand, Gua_Object *object, Gua_String error);
+Gua_Status Gua_PowerOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_MultOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_PlusOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_ShiftOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_LessOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_EqualOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_BitAndOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_BitXOrOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_BitOrOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_LogicAndOrOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_LogicAndOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Status Gua_LogicOrOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+
+/* Compiler and virtual machine macros and functions. */
+#define Gua_CodeConstant(c,i) ((c)->constant[i])
+#define Gua_CodeString(c,i) ((c)->constant[i].string)
+
+Gua_Short Gua_OperatorLevel(Gua_Short op);
+Gua_Short Gua_IntegerOperator(Gua_Short op, Gua_Integer operand1, Gua_Integer operand2, Gua_Object *object);
+Gua_Short Gua_RealOperator(Gua_Short op, Gua_Real operand1, Gua_Real operand2, Gua_Object *object);
+Gua_Short Gua_ScalarOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object);
+Gua_Status Gua_BinaryOperator(Gua_Short op, Gua_Object *operand1, Gua_Object *operand2, Gua_Object *object, Gua_String error);
+Gua_Code *Gua_NewCode(Gua_String start);
+void Gua_FreeCode(Gua_Code *code);
+Gua_Integer Gua_Emit(Gua_Code *code, Gua_Short opcode, Gua_Short a, Gua_Integer b);
+Gua_Integer Gua_AddConstant(Gua_Code *code, Gua_Object *object);
+Gua_Integer Gua_AddString(Gua_Code *code, Gua_String start, Gua_Length length);
+Gua_Integer Gua_AddLocal(Gua_Code *code, Gua_String name);
+void Gua_AddCommand(Gua_Code *code, Gua_Integer first, Gua_String start);
+void Gua_AddLoop(Gua_Code *code, Gua_Integer first, Gua_Integer last, Gua_Integer slot, Gua_Integer keep, Gua_Integer next, Gua_Integer end);
+void Gua_RevertCode(Gua_Code *code, Gua_Integer length, Gua_Integer constants, Gua_Integer commands, Gua_Integer loops, Gua_Integer depth);
+Gua_Short Gua_SplitCommands(Gua_Token *token, Gua_Short argc, Gua_Token *command);
+Gua_Status Gua_CompileNested(Gua_Code *code, Gua_Token *token);
+Gua_Status Gua_CompileArguments(Gua_Code *code, Gua_Token *token, Gua_Integer *argc);
+Gua_Status Gua_CompileMatrix(Gua_Code *code, Gua_Token *token, Gua_Integer *rows, Gua_Integer *columns);
+Gua_String Gua_CompileObject(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Status *status);
+Gua_Short Gua_FoldConstants(Gua_Code *code, Gua_Integer first, Gua_Integer constants, Gua_Integer commands, Gua_Integer depth);
+Gua_String Gua_CompileUnary(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Status *status);
+Gua_String Gua_CompileBinary(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Short level, Gua_Status *status);
+Gua_String Gua_CompileAppend(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Integer name, Gua_Status *status);
+Gua_String Gua_CompileAssign(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Status *status);
+Gua_String Gua_CompileIf(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Status *status);
+Gua_String Gua_CompileWhile(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Status *status);
+Gua_String Gua_CompileDo(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Status *status);
+Gua_String Gua_CompileFor(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Status *status);
+Gua_String Gua_CompileForeach(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Status *status);
+Gua_String Gua_CompileStatement(Gua_Code *code, Gua_String start, Gua_Token *token, Gua_Status *status);
+Gua_Status Gua_CompileBlock(Gua_Code *code, Gua_String start);
+Gua_Code *Gua_Compile(Gua_String start);
+Gua_Code *Gua_CompileCached(Gua_String start);
+void Gua_GetCodeCacheStatistics(Gua_PoolStatistics *statistics);
+Gua_Status Gua_CallFunction(Gua_Namespace *nspace, Gua_String name, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Short Gua_AppendString(Gua_Object *target, Gua_Object *object);
+Gua_Status Gua_LoadVariable(Gua_Namespace *nspace, Gua_String name, Gua_Object *object, Gua_String error);
+Gua_Status Gua_LoadElement(Gua_Namespace *nspace, Gua_String name, Gua_String expression, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_StoreVariable(Gua_Namespace *nspace, Gua_String name, Gua_Object *object, Gua_String error);
+Gua_Status Gua_AppendVariable(Gua_Namespace *nspace, Gua_String name, Gua_Object *object, Gua_Object *result, Gua_String error);
+Gua_Status Gua_StoreElement(Gua_Namespace *nspace, Gua_String name, Gua_String expression, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Gua_BindArguments(Gua_Function *function, Gua_Namespace *local, Gua_Short argc, Gua_Object *argv, Gua_String error);
+Gua_Status Gua_EnterCall(Gua_String name, Gua_Short nested, Gua_String error);
+void Gua_LeaveCall(void);
+void Gua_NewCallFrame(Gua_CallFrame *frame, Gua_Namespace *nspace, Gua_Code *code);
+void Gua_FreeCallFrame(Gua_CallFrame *frame);
+void Gua_PushCallFrame(Gua_CallFrame *frame);
+void Gua_PopCallFrame(Gua_CallFrame *frame);
+void Gua_AddErrorTrail(Gua_Code *code, Gua_Integer pc, Gua_String error);
+Gua_Status Gua_Execute(Gua_Namespace *nspace, Gua_Code *code, Gua_Object *object, Gua_Status *status, Gua_String error);
 
 /* The following macros and functions were designed for general purpose use. */
 
 /*
  * Support for, platform independent, memory management.
+ * The blocks allocated are counted for the trace statistics.
+ * When the memory accounting is on, the blocks are counted by size
+ * and by owner too, see Gua_SetMemoryAccounting.
  */
-#define Gua_Alloc(s) malloc(s)
-#define Gua_Realloc(p,s) realloc(p,s)
-#define Gua_Free(p) free(p)
+extern Gua_Integer Gua_Allocations;
+extern Gua_Short Gua_MemoryAccounting;
+
+#define Gua_Alloc(s) Gua_AllocType(s, MEMORY_TYPE_OTHER)
+#define Gua_AllocType(s,t) (Gua_MemoryAccounting ? Gua_CountAlloc(s, t) : (Gua_Allocations++, malloc(s)))
+#define Gua_Realloc(p,s) Gua_ReallocType(p, s, MEMORY_TYPE_OTHER)
+#define Gua_ReallocType(p,s,t) (Gua_MemoryAccounting ? Gua_CountRealloc(p, s, t) : realloc(p, s))
+#define Gua_Free(p) (Gua_MemoryAccounting ? Gua_CountFree(p) : free(p))
 
 /*
  * Support for manipulation of objects,
@@ -398,428 +757,176 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
  */
 #define Gua_ClearObject(o) { \
     (o).type = OBJECT_TYPE_UNKNOWN; \
-    (o).integer = 0; \
     (o).real = 0.0; \
     (o).imaginary = 0.0; \
-    (o).string = NULL; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
-    (o).length = 0; \
     (o).stored = false; \
 }
 #define Gua_ClearPObject(o) { \
     (o)->type = OBJECT_TYPE_UNKNOWN; \
-    (o)->integer = 0; \
     (o)->real = 0.0; \
     (o)->imaginary = 0.0; \
-    (o)->string = NULL; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
-    (o)->length = 0; \
     (o)->stored = false; \
 }
 #define Gua_LinkObjects(t,s) { \
-    (t).type = (s).type; \
-    (t).integer = (s).integer; \
-    (t).real = (s).real; \
-    (t).imaginary = (s).imaginary; \
-    (t).string = (s).string; \
-    (t).array = (s).array; \
-    (t).matrix = (s).matrix; \
-    (t).file = (s).file; \
-    (t).handle = (s).handle; \
-    (t).nspace = (s).nspace; \
-    (t).length = (s).length; \
-    (t).stored = (s).stored; \
+    (t) = (s); \
 }
 #define Gua_LinkPObjects(t,s) { \
-    (t)->type = (s)->type; \
-    (t)->integer = (s)->integer; \
-    (t)->real = (s)->real; \
-    (t)->imaginary = (s)->imaginary; \
-    (t)->string = (s)->string; \
-    (t)->array = (s)->array; \
-    (t)->matrix = (s)->matrix; \
-    (t)->file = (s)->file; \
-    (t)->handle = (s)->handle; \
-    (t)->nspace = (s)->nspace; \
-    (t)->length = (s)->length; \
-    (t)->stored = (s)->stored; \
+    *(t) = *(s); \
 }
 #define Gua_LinkFromPObject(t,s) { \
-    (t).type = (s)->type; \
-    (t).integer = (s)->integer; \
-    (t).real = (s)->real; \
-    (t).imaginary = (s)->imaginary; \
-    (t).string = (s)->string; \
-    (t).array = (s)->array; \
-    (t).matrix = (s)->matrix; \
-    (t).file = (s)->file; \
-    (t).handle = (s)->handle; \
-    (t).nspace = (s)->nspace; \
-    (t).length = (s)->length; \
-    (t).stored = (s)->stored; \
+    (t) = *(s); \
 }
 #define Gua_LinkToPObject(t,s) { \
-    (t)->type = (s).type; \
-    (t)->integer = (s).integer; \
-    (t)->real = (s).real; \
-    (t)->imaginary = (s).imaginary; \
-    (t)->string = (s).string; \
-    (t)->array = (s).array; \
-    (t)->matrix = (s).matrix; \
-    (t)->file = (s).file; \
-    (t)->handle = (s).handle; \
-    (t)->nspace = (s).nspace; \
-    (t)->length = (s).length; \
-    (t)->stored = (s).stored; \
+    *(t) = (s); \
 }
 #define Gua_IntegerToObject(o,i) { \
     (o).type = OBJECT_TYPE_INTEGER; \
     (o).integer = i; \
-    (o).real = 0.0; \
     (o).imaginary = 0.0; \
-    (o).string = NULL; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
-    (o).length = 0; \
     (o).stored = false; \
 }
 #define Gua_IntegerToPObject(o,i) { \
     (o)->type = OBJECT_TYPE_INTEGER; \
     (o)->integer = i; \
-    (o)->real = 0.0; \
     (o)->imaginary = 0.0; \
-    (o)->string = NULL; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
-    (o)->length = 0; \
     (o)->stored = false; \
 }
 #define Gua_RealToObject(o,r) { \
     (o).type = OBJECT_TYPE_REAL; \
-    (o).integer = 0; \
     (o).real = r; \
     (o).imaginary = 0.0; \
-    (o).string = NULL; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
-    (o).length = 0; \
     (o).stored = false; \
 }
 #define Gua_RealToPObject(o,r) { \
     (o)->type = OBJECT_TYPE_REAL; \
-    (o)->integer = 0; \
     (o)->real = r; \
     (o)->imaginary = 0.0; \
-    (o)->string = NULL; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
-    (o)->length = 0; \
     (o)->stored = false; \
 }
 #define Gua_ComplexToObject(o,r,i) { \
     (o).type = OBJECT_TYPE_COMPLEX; \
-    (o).integer = 0; \
     (o).real = r; \
     (o).imaginary = i; \
-    (o).string = NULL; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
-    (o).length = 0; \
     (o).stored = false; \
 }
 #define Gua_ComplexToPObject(o,r,i) { \
     (o)->type = OBJECT_TYPE_COMPLEX; \
-    (o)->integer = 0; \
     (o)->real = r; \
     (o)->imaginary = i; \
-    (o)->string = NULL; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
-    (o)->length = 0; \
     (o)->stored = false; \
 }
 #define Gua_StringToObject(o,s) { \
     (o).type = OBJECT_TYPE_STRING; \
-    (o).integer = 0; \
-    (o).real = 0.0; \
-    (o).imaginary = 0.0; \
-    (o).string = (Gua_String)malloc(sizeof(char) * (strlen(s) + 1)); \
+    (o).string = (Gua_String)Gua_AllocType(sizeof(char) * (strlen(s) + 1), MEMORY_TYPE_STRING); \
     memset((o).string, '\0', sizeof(char) * (strlen(s) + 1)); \
     strncpy((o).string, s, strlen(s)); \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
     (o).length = strlen(s); \
     (o).stored = false; \
 }
 #define Gua_StringToPObject(o,s) { \
     (o)->type = OBJECT_TYPE_STRING; \
-    (o)->integer = 0; \
-    (o)->real = 0.0; \
-    (o)->imaginary = 0.0; \
-    (o)->string = (Gua_String)malloc(sizeof(char) * (strlen(s) + 1)); \
+    (o)->string = (Gua_String)Gua_AllocType(sizeof(char) * (strlen(s) + 1), MEMORY_TYPE_STRING); \
     memset((o)->string, '\0', sizeof(char) * (strlen(s) + 1)); \
     strncpy((o)->string, s, strlen(s)); \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
     (o)->length = strlen(s); \
     (o)->stored = false; \
 }
 #define Gua_ByteArrayToObject(o,s,n) { \
     (o).type = OBJECT_TYPE_STRING; \
-    (o).integer = 0; \
-    (o).real = 0.0; \
-    (o).imaginary = 0.0; \
-    (o).string = (Gua_String)malloc(sizeof(char) * (n + 1)); \
+    (o).string = (Gua_String)Gua_AllocType(sizeof(char) * (n + 1), MEMORY_TYPE_STRING); \
     memset((o).string, '\0', sizeof(char) * (n + 1)); \
     memcpy((o).string, s, n); \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
     (o).length = n; \
     (o).stored = false; \
 }
 #define Gua_ByteArrayToPObject(o,s,n) { \
     (o)->type = OBJECT_TYPE_STRING; \
-    (o)->integer = 0; \
-    (o)->real = 0.0; \
-    (o)->imaginary = 0.0; \
-    (o)->string = (Gua_String)malloc(sizeof(char) * (n + 1)); \
+    (o)->string = (Gua_String)Gua_AllocType(sizeof(char) * (n + 1), MEMORY_TYPE_STRING); \
     memset((o)->string, '\0', sizeof(char) * (n + 1)); \
     memcpy((o)->string, s, n); \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
     (o)->length = n; \
     (o)->stored = false; \
 }
 #define Gua_LinkStringToObject(o,s) { \
     (o).type = OBJECT_TYPE_STRING; \
-    (o).integer = 0; \
-    (o).real = 0.0; \
-    (o).imaginary = 0.0; \
     (o).string = s; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
     (o).length = strlen(s); \
     (o).stored = false; \
 }
 #define Gua_LinkStringToPObject(o,s) { \
     (o)->type = OBJECT_TYPE_STRING; \
-    (o)->integer = 0; \
-    (o)->real = 0.0; \
-    (o)->imaginary = 0.0; \
     (o)->string = s; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
     (o)->length = strlen(s); \
     (o)->stored = false; \
 }
 #define Gua_LinkByteArrayToObject(o,s,n) { \
     (o).type = OBJECT_TYPE_STRING; \
-    (o).integer = 0; \
-    (o).real = 0.0; \
-    (o).imaginary = 0.0; \
     (o).string = s; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
     (o).length = n; \
     (o).stored = false; \
 }
 #define Gua_LinkByteArrayToPObject(o,s,n) { \
     (o)->type = OBJECT_TYPE_STRING; \
-    (o)->integer = 0; \
-    (o)->real = 0.0; \
-    (o)->imaginary = 0.0; \
     (o)->string = s; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
     (o)->length = n; \
     (o)->stored = false; \
 }
 #define Gua_ArrayToObject(o,a,n) { \
     (o).type = OBJECT_TYPE_ARRAY; \
-    (o).integer = 0; \
-    (o).real = 0.0; \
-    (o).imaginary = 0.0; \
-    (o).string = NULL; \
     (o).array = a; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
     (o).length = n; \
     (o).stored = false; \
 }
 #define Gua_ArrayToPObject(o,a,n) { \
     (o)->type = OBJECT_TYPE_ARRAY; \
-    (o)->integer = 0; \
-    (o)->real = 0.0; \
-    (o)->imaginary = 0.0; \
-    (o)->string = NULL; \
     (o)->array = a; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
     (o)->length = n; \
     (o)->stored = false; \
 }
 #define Gua_MatrixToObject(o,m,n) { \
     (o).type = OBJECT_TYPE_MATRIX; \
-    (o).integer = 0; \
-    (o).real = 0.0; \
-    (o).imaginary = 0.0; \
-    (o).string = NULL; \
-    (o).array = NULL; \
     (o).matrix = m; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
     (o).length = n; \
     (o).stored = false; \
 }
 #define Gua_MatrixToPObject(o,m,n) { \
     (o)->type = OBJECT_TYPE_MATRIX; \
-    (o)->integer = 0; \
-    (o)->real = 0.0; \
-    (o)->imaginary = 0.0; \
-    (o)->string = NULL; \
-    (o)->array = NULL; \
     (o)->matrix = m; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
     (o)->length = n; \
     (o)->stored = false; \
 }
 #define Gua_FileToObject(o,h) { \
     (o).type = OBJECT_TYPE_FILE; \
-    (o).integer = 0; \
-    (o).real = 0.0; \
-    (o).imaginary = 0.0; \
-    (o).string = NULL; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
     (o).file = h; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
     (o).length = 0; \
     (o).stored = false; \
 }
 #define Gua_FileToPObject(o,h) { \
     (o)->type = OBJECT_TYPE_FILE; \
-    (o)->integer = 0; \
-    (o)->real = 0.0; \
-    (o)->imaginary = 0.0; \
-    (o)->string = NULL; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
     (o)->file = h; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
     (o)->length = 0; \
     (o)->stored = false; \
 }
 #define Gua_HandleToObject(o,h) { \
     (o).type = OBJECT_TYPE_HANDLE; \
-    (o).integer = 0; \
-    (o).real = 0.0; \
-    (o).imaginary = 0.0; \
-    (o).string = NULL; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
     (o).handle = h; \
-    (o).nspace = NULL; \
     (o).length = 0; \
     (o).stored = false; \
 }
 #define Gua_HandleToPObject(o,h) { \
     (o)->type = OBJECT_TYPE_HANDLE; \
-    (o)->integer = 0; \
-    (o)->real = 0.0; \
-    (o)->imaginary = 0.0; \
-    (o)->string = NULL; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
     (o)->handle = h; \
-    (o)->nspace = NULL; \
     (o)->length = 0; \
     (o)->stored = false; \
 }
 #define Gua_NamespaceToObject(o,s) { \
     (o).type = OBJECT_TYPE_NAMESPACE; \
-    (o).integer = 0; \
-    (o).real = 0.0; \
-    (o).imaginary = 0.0; \
-    (o).string = NULL; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
     (o).nspace = s; \
     (o).length = 0; \
     (o).stored = false; \
 }
 #define Gua_NamespaceToPObject(o,s) { \
     (o)->type = OBJECT_TYPE_NAMESPACE; \
-    (o)->integer = 0; \
-    (o)->real = 0.0; \
-    (o)->imaginary = 0.0; \
-    (o)->string = NULL; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
     (o)->nspace = s; \
     (o)->length = 0; \
     (o)->stored = false; \
@@ -831,29 +938,13 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
 #define Gua_ConvertIntegerObjectToReal(o) { \
     (o).type = OBJECT_TYPE_REAL; \
     (o).real = (o).integer; \
-    (o).integer = 0; \
     (o).imaginary = 0.0; \
-    (o).string = NULL; \
-    (o).array = NULL; \
-    (o).matrix = NULL; \
-    (o).file = NULL; \
-    (o).handle = NULL; \
-    (o).nspace = NULL; \
-    (o).length = 0; \
     (o).stored = false; \
 }
 #define Gua_ConvertIntegerPObjectToReal(o) { \
     (o)->type = OBJECT_TYPE_REAL; \
     (o)->real = (o)->integer; \
-    (o)->integer = 0; \
     (o)->imaginary = 0.0; \
-    (o)->string = NULL; \
-    (o)->array = NULL; \
-    (o)->matrix = NULL; \
-    (o)->file = NULL; \
-    (o)->handle = NULL; \
-    (o)->nspace = NULL; \
-    (o)->length = 0; \
     (o)->stored = false; \
 }
 
@@ -878,12 +969,14 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
 #define Gua_ObjectToImaginary(o) (o).imaginary
 #define Gua_ObjectToString(o) (o).string
 #define Gua_ObjectToArray(o) (o).array
+#define Gua_ObjectToElement(o) ((o).array ? ((Gua_Array *)(o).array)->first : NULL)
 #define Gua_ObjectToMatrix(o) (o).matrix
 #define Gua_ObjectToFile(o) (o).file
 #define Gua_ObjectToHandle(o) (o).handle
 #define Gua_ObjectToNamespace(o) (o).nspace
 #define Gua_ObjectLength(o) (o).length
 #define Gua_IsObjectStored(o) (o).stored
+#define Gua_IsObjectTrue(o) (((o).type == OBJECT_TYPE_INTEGER) && ((o).integer != 0))
 
 #define Gua_PObjectType(o) (o)->type
 #define Gua_PObjectToInteger(o) (o)->integer
@@ -891,16 +984,18 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
 #define Gua_PObjectToImaginary(o) (o)->imaginary
 #define Gua_PObjectToString(o) (o)->string
 #define Gua_PObjectToArray(o) (o)->array
+#define Gua_PObjectToElement(o) ((o)->array ? ((Gua_Array *)(o)->array)->first : NULL)
 #define Gua_PObjectToMatrix(o) (o)->matrix
 #define Gua_PObjectToFile(o) (o)->file
 #define Gua_PObjectToHandle(o) (o)->handle
 #define Gua_PObjectToNamespace(o) (o)->nspace
 #define Gua_PObjectLength(o) (o)->length
 #define Gua_IsPObjectStored(o) (o)->stored
+#define Gua_IsPObjectTrue(o) (((o)->type == OBJECT_TYPE_INTEGER) && ((o)->integer != 0))
 
 /* Generic file handles support. */
 #define Gua_NewFile(h,p) { \
-    h = (Gua_File *)malloc(sizeof(Gua_File)); \
+    h = (Gua_File *)Gua_Alloc(sizeof(Gua_File)); \
     Gua_ClearFile(h); \
     (h)->file = p; \
 }
@@ -987,9 +1082,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
 
 /* Generic handles support. */
 #define Gua_NewHandle(h,t,p) { \
-    h = (Gua_Handle *)malloc(sizeof(Gua_Handle)); \
+    h = (Gua_Handle *)Gua_Alloc(sizeof(Gua_Handle)); \
     Gua_ClearHandle(h); \
-    (h)->type = (Gua_String)malloc(sizeof(char) * (strlen(t) + 1)); \
+    (h)->type = (Gua_String)Gua_Alloc(sizeof(char) * (strlen(t) + 1)); \
     memset((h)->type, '\0', sizeof(char) * (strlen(t) + 1)); \
     strncpy((h)->type, t, strlen(t)); \
     (h)->pointer = p; \
@@ -1010,15 +1105,19 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
 #define Gua_SetHandleType(h,t) {(h)->type = t;}
 #define Gua_SetHandlePointer(h,p) {(h)->pointer = p;}
 
+/*
+ * Support for manipulation of namespaces,
+ * independent of the version of the interpreter.
+ */
+#define Gua_GlobalNamespace(n) ((n)->global ? (Gua_Namespace *)(n)->global : (n))
+
 /*
  * Support for manipulation of variables,
  * independent of the version of the interpreter.
  */
 #define Gua_NewVariable(v,n) { \
-    v = (Gua_Variable *)malloc(sizeof(Gua_Variable)); \
-    (v)->name = (Gua_String)malloc(sizeof(char) * (strlen(n) + 1)); \
-    memset((v)->name, '\0', sizeof(char) * (strlen(n) + 1)); \
-    strncpy((v)->name, n, strlen(n)); \
+    v = Gua_AllocVariable(); \
+    (v)->name = Gua_Intern(n); \
 }
 
 /*
@@ -1026,10 +1125,8 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
  * independent of the version of the interpreter.
  */
 #define Gua_NewFunction(f,n) { \
-    f = (Gua_Function *)malloc(sizeof(Gua_Function)); \
-    (f)->name = (Gua_String)malloc(sizeof(char) * (strlen(n) + 1)); \
-    memset((f)->name, '\0', sizeof(char) * (strlen(n) + 1)); \
-    strncpy((f)->name, n, strlen(n)); \
+    f = (Gua_Function *)Gua_Alloc(sizeof(Gua_Function)); \
+    (f)->name = Gua_Intern(n); \
 }
 #define Gua_ClearFunction(f) { \
     (f).type = FUNCTION_TYPE_C; \
@@ -1038,8 +1135,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
     (f).argc = 0; \
     (f).argv = NULL; \
     (f).script = NULL; \
-    (f).previous = NULL; \
-    (f).next = NULL; \
+    (f).line = 0; \
+    (f).code = NULL; \
+    (f).types = NULL; \
 }
 #define Gua_ClearPFunction(f) { \
     (f)->type = FUNCTION_TYPE_C; \
@@ -1048,8 +1146,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
     (f)->argc = 0; \
     (f)->argv = NULL; \
     (f)->script = NULL; \
-    (f)->previous = NULL; \
-    (f)->next = NULL; \
+    (f)->line = 0; \
+    (f)->code = NULL; \
+    (f)->types = NULL; \
 }
 #define Gua_LinkFunctions(t,s) { \
     (t).type = (s).type; \
@@ -1058,8 +1157,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
     (t).argc = (s).argc; \
     (t).argv = (s).argv; \
     (t).script = (s).script; \
-    (t).previous = (s).previous; \
-    (t).next = (s).next; \
+    (t).line = (s).line; \
+    (t).code = (s).code; \
+    (t).types = (s).types; \
 }
 #define Gua_LinkPFunctions(t,s) { \
     (t)->type = (s)->type; \
@@ -1068,8 +1168,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
     (t)->argc = (s)->argc; \
     (t)->argv = (s)->argv; \
     (t)->script = (s)->script; \
-    (t)->previous = (s)->previous; \
-    (t)->next = (s)->next; \
+    (t)->line = (s)->line; \
+    (t)->code = (s)->code; \
+    (t)->types = (s)->types; \
 }
 #define Gua_LinkFromPFunction(t,s) { \
     (t).type = (s)->type; \
@@ -1078,8 +1179,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
     (t).argc = (s)->argc; \
     (t).argv = (s)->argv; \
     (t).script = (s)->script; \
-    (t).previous = (s)->previous; \
-    (t).next = (s)->next; \
+    (t).line = (s)->line; \
+    (t).code = (s)->code; \
+    (t).types = (s)->types; \
 }
 #define Gua_LinkToPFunction(t,s) { \
     (t)->type = (s).type; \
@@ -1088,8 +1190,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
     (t)->argc = (s).argc; \
     (t)->argv = (s).argv; \
     (t)->script = (s).script; \
-    (t)->previous = (s).previous; \
-    (t)->next = (s).next; \
+    (t)->line = (s).line; \
+    (t)->code = (s).code; \
+    (t)->types = (s).types; \
 }
 #define Gua_LinkCFunctionToFunction(f,c) { \
     (f).type = FUNCTION_TYPE_C; \
@@ -1098,8 +1201,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
     (f).argc = 0; \
     (f).argv = NULL; \
     (f).script = NULL; \
-    (f).previous = NULL; \
-    (f).next = NULL; \
+    (f).line = 0; \
+    (f).code = NULL; \
+    (f).types = NULL; \
 }
 #define Gua_LinkCFunctionToPFunction(f,c) { \
     (f)->type = FUNCTION_TYPE_C; \
@@ -1108,8 +1212,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
     (f)->argc = 0; \
     (f)->argv = NULL; \
     (f)->script = NULL; \
-    (f)->previous = NULL; \
-    (f)->next = NULL; \
+    (f)->line = 0; \
+    (f)->code = NULL; \
+    (f)->types = NULL; \
 }
 #define Gua_SetPFunctionFromPFunction(t,s) { \
     (t)->type = (s)->type; \
@@ -1117,6 +1222,9 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
     (t)->argc = (s)->argc; \
     (t)->argv = (s)->argv; \
     (t)->script = (s)->script; \
+    (t)->line = (s)->line; \
+    (t)->code = NULL; \
+    (t)->types = (s)->types; \
 }
 #define Gua_ClearArguments(argc,argv) { \
     { \
@@ -1130,37 +1238,73 @@ Gua_String Gua_ParseObject(Gua_Namespace *nspace, Gua_String start, Gua_Token *t
 #define Gua_ArgName(a) (a).name
 #define Gua_ArgObject(a) (a).object
 
+unsigned long Gua_HashString(Gua_String string, Gua_Length length);
+Gua_String Gua_FindAtom(Gua_String name, Gua_Length length);
+Gua_String Gua_Intern(Gua_String name);
+Gua_Integer Gua_AtomSlot(Gua_String atom, Gua_Integer size);
+Gua_Integer Gua_GetAtomCount(void);
 void Gua_ClearNamespace(Gua_Namespace *nspace);
 void Gua_FreeNamespace(Gua_Namespace *nspace);
-Gua_Short Gua_NamespaceSlot(Gua_String name);
-void Gua_FreeVariableList(Gua_Variable *variable);
+void Gua_CountFrameSymbol(Gua_String atom, Gua_Integer n);
+Gua_Integer Gua_FrameSymbols(Gua_String atom);
+Gua_Namespace *Gua_OuterNamespace(Gua_Namespace *nspace, Gua_String atom);
+Gua_Namespace *Gua_NewFrame(Gua_Namespace *previous);
+void Gua_FreeFrame(Gua_Namespace *frame);
+void Gua_MergeFrame(Gua_Namespace *frame);
+Gua_Variable *Gua_FindVariable(Gua_Namespace *nspace, Gua_String atom);
+void Gua_InsertVariable(Gua_Namespace *nspace, Gua_Variable *variable);
+Gua_Variable *Gua_RemoveVariable(Gua_Namespace *nspace, Gua_String atom);
+Gua_Variable *Gua_AllocVariable(void);
 void Gua_FreeVariable(Gua_Variable *variable);
+void Gua_AssignVariable(Gua_Variable *variable, Gua_Object *object);
 Gua_Status Gua_UnsetVariable(Gua_Namespace *nspace, Gua_String name, Gua_Short scope);
+Gua_Variable *Gua_LookupVariable(Gua_Namespace *nspace, Gua_String atom, Gua_Short scope);
 Gua_Status Gua_SearchVariable(Gua_Namespace *nspace, Gua_String name, Gua_Object *object, Gua_Short scope);
+void Gua_InitConstants(void);
+Gua_Variable *Gua_FindConstant(Gua_String atom);
 Gua_Status Gua_GetVariable(Gua_Namespace *nspace, Gua_String name, Gua_Object *object, Gua_Short scope);
 Gua_Status Gua_SetVariable(Gua_Namespace *nspace, Gua_String name, Gua_Object *object, Gua_Short scope);
 Gua_Status Gua_UpdateObject(Gua_Namespace *nspace, Gua_String name, Gua_Object *object, Gua_Short scope);
-void Gua_FreeFunctionList(Gua_Function *function);
+Gua_Function *Gua_FindFunction(Gua_Namespace *nspace, Gua_String atom);
+void Gua_InsertFunction(Gua_Namespace *nspace, Gua_Function *function);
+Gua_Function *Gua_RemoveFunction(Gua_Namespace *nspace, Gua_String atom);
 void Gua_FreeFunction(Gua_Function *function);
 Gua_Status Gua_UnsetFunction(Gua_Namespace *nspace, Gua_String name);
 Gua_Status Gua_SearchFunction(Gua_Namespace *nspace, Gua_String name, Gua_Function *function);
 Gua_Status Gua_GetFunction(Gua_Namespace *nspace, Gua_String name, Gua_Function *function);
+Gua_Function *Gua_ResolveFunction(Gua_Namespace *nspace, Gua_Namespace *global, Gua_CallSite *site);
 Gua_Status Gua_SetFunction(Gua_Namespace *nspace, Gua_String name, Gua_Function *function);
-void Gua_FreeArray(Gua_Element *array);
+Gua_Status Gua_SetFunctions(Gua_Namespace *nspace, Gua_FunctionEntry *entries, Gua_String error);
+Gua_Status Gua_ApplyFunction(Gua_Function *function, void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Code *Gua_GetFunctionCode(Gua_Namespace *nspace, Gua_String name);
+Gua_Type Gua_SymbolType(Gua_Namespace *nspace, Gua_String atom);
+Gua_Array *Gua_NewArray(void);
+Gua_Matrix *Gua_NewMatrix(void);
+Gua_Element *Gua_AllocElement(void);
+void Gua_FreeElement(Gua_Element *element);
+void Gua_FreeArray(Gua_Array *array);
+unsigned long Gua_HashKey(Gua_Object *key);
+Gua_Short Gua_IsKeyEqual(Gua_Object *a, Gua_Object *b);
+void Gua_IndexArray(Gua_Array *array);
+Gua_Element *Gua_FindArrayElement(Gua_Object *array, Gua_Object *key);
+void Gua_RemoveArrayElement(Gua_Object *array, Gua_Element *element);
 void Gua_FreeMatrix(Gua_Matrix *matrix);
 void Gua_FreeHandle(Gua_Handle *handle);
 void Gua_FreeObject(Gua_Object *object);
 Gua_Status Gua_UnsetArrayElement(Gua_Object *array, Gua_Object *key);
 Gua_Status Gua_GetArrayElement(Gua_Object *array, Gua_Object *key, Gua_Object *object);
 Gua_Status Gua_SetArrayElement(Gua_Object *array, Gua_Object *key, Gua_Object *object, Gua_Stored stored);
+void Gua_AppendArrayElement(Gua_Object *array, Gua_Element *element);
 void Gua_SetStoredArray(Gua_Object *array, Gua_Stored stored);
 Gua_Status Gua_CopyArray(Gua_Object *target, Gua_Object *source, Gua_Stored stored);
+Gua_Short Gua_UnshareArray(Gua_Object *array);
 Gua_Status Gua_GetArrayKeys(Gua_Object *keys, Gua_Object *array);
 Gua_Status Gua_ArrayToString(Gua_Object *array, Gua_Object *object);
 Gua_Status Gua_ArgsToString(Gua_Short argc, Gua_Object *argv, Gua_Object *object);
 Gua_Status Gua_IsArrayEqual(Gua_Object *a, Gua_Object *b);
 void Gua_SetStoredMatrix(Gua_Object *matrix, Gua_Stored stored);
 Gua_Status Gua_CopyMatrix(Gua_Object *target, Gua_Object *source, Gua_Stored stored);
+Gua_Short Gua_UnshareMatrix(Gua_Object *matrix);
 Gua_Status Gua_GetMatrixDim(Gua_Object *array, Gua_Object *matrix);
 Gua_Status Gua_MatrixToString(Gua_Object *matrix, Gua_Object *object);
 Gua_Status Gua_IsMatrixEqual(Gua_Object *a, Gua_Object *b);
@@ -1179,7 +1323,42 @@ Gua_Status Gua_CopyFile(Gua_Object *target, Gua_Object *source, Gua_Stored store
 Gua_Status Gua_CopyHandle(Gua_Object *target, Gua_Object *source, Gua_Stored stored);
 Gua_Status Gua_ElapsedTime(Gua_Time *result, Gua_Time *tv1, Gua_Time *tv2);
 Gua_String Gua_Expression(Gua_Namespace *nspace, Gua_String start, Gua_Object *object, Gua_Status *status, Gua_String error);
+Gua_String Gua_Interpret(Gua_Namespace *nspace, Gua_String start, Gua_Object *object, Gua_Status *status, Gua_String error);
 Gua_String Gua_Evaluate(Gua_Namespace *nspace, Gua_String start, Gua_Object *object, Gua_Status *status, Gua_String error);
+Gua_String Gua_EvaluateCached(Gua_Namespace *nspace, Gua_String start, Gua_Object *object, Gua_Status *status, Gua_String error);
+void Gua_SetCompileMode(Gua_Short mode);
+Gua_Short Gua_GetCompileMode(void);
+void Gua_SetMaxCallDepth(Gua_Integer depth);
+Gua_Integer Gua_GetMaxCallDepth(void);
+Gua_Integer Gua_GetCallDepth(void);
+void Gua_PushProfileFrame(Gua_String name, Gua_String source, Gua_Integer line, Gua_Code *code);
+void Gua_PopProfileFrame(void);
+void Gua_SetFrameBase(Gua_ProfileFrame *frame);
+Gua_Integer Gua_SourceLine(Gua_ProfileFrame *frame, Gua_String position);
+Gua_Short Gua_IsFrameSource(Gua_ProfileFrame *frame, Gua_String position);
+Gua_String Gua_SearchFrameSource(Gua_ProfileFrame *frame, Gua_String text);
+Gua_ProfileEntry *Gua_CountProfileEntry(Gua_ProfileTable *table, Gua_String key);
+void Gua_FreeProfileTable(Gua_ProfileTable *table);
+Gua_Length Gua_AppendProfileKey(Gua_Length length, Gua_String separator, Gua_String text);
+void Gua_RecordSamples(void);
+void Gua_ProfileHandler(int signal);
+Gua_Status Gua_StartProfile(Gua_Integer rate, Gua_String error);
+void Gua_StopProfile(void);
+int Gua_CompareProfileEntries(const void *a, const void *b);
+void Gua_WriteProfileTable(FILE *fp, Gua_String title, Gua_ProfileTable *table, Gua_Short totals);
+Gua_Status Gua_WriteProfile(Gua_String report, Gua_String folded, Gua_String error);
+Gua_Real Gua_TraceClock(void);
+Gua_TraceEntry *Gua_GetTraceEntry(Gua_TraceTable *table, Gua_String name, Gua_Integer line);
+int Gua_CompareCommands(const void *a, const void *b);
+Gua_TraceEntry **Gua_TraceCode(Gua_Code *code, Gua_String name);
+void Gua_EndTraceStatement(Gua_ProfileFrame *frame, Gua_Real now);
+void Gua_TraceStatement(Gua_TraceEntry *entry);
+Gua_TraceEntry *Gua_TraceLoop(Gua_String position);
+void Gua_StartTrace(void);
+void Gua_StopTrace(void);
+int Gua_CompareTraceEntries(const void *a, const void *b);
+Gua_TraceEntry **Gua_SortTraceTable(Gua_TraceTable *table);
+Gua_Status Gua_WriteTrace(Gua_String file, Gua_String error);
 void Gua_ParseVarAssignment(Gua_String expression, Gua_String variable, Gua_String value);
 void Gua_KeyValuePairsToArray(Gua_Short n, Gua_String *key, Gua_String *value, Gua_Object *object);
 void Gua_ArgvToArray(int argc, char **argv, Gua_Object *object);
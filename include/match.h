@@ -30,6 +30,7 @@
 
 Gua_Integer Match_Match(Gua_String string, Gua_String pattern);
 Gua_Status Match_Glob(Gua_String directory, Gua_String pattern, Gua_Object *list, Gua_Integer max, Gua_String error);
-Gua_Status Match_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Match_GlobFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Match_MatchFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Match_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error);
 
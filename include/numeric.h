@@ -32,5 +32,5 @@
 #define NUMERIC_XYZ "{\"x\", \"y\", \"z\"}"
 
 Gua_Status Numeric_GaussLSS(Gua_Object *a, Gua_Object *b, Gua_Object *x, Gua_String error);
-Gua_Status Numeric_NumericFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Numeric_GaussLSSFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Numeric_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error);
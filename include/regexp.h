@@ -77,6 +77,7 @@ Gua_Integer Regexp_Execute(Regexp_Regex *regex, Gua_String lp);
 Gua_String Regexp_PatternMatch(Regexp_Regex *regex, Gua_String lp, Gua_String ap);
 Gua_Integer Regexp_Replace(Regexp_Regex *regex, Gua_String src, Gua_String dst);
 void Regex_Fail(Gua_String err, Gua_Char c);
-Gua_Status Regexp_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Regexp_RegexpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
+Gua_Status Regexp_RegsubFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error);
 Gua_Status Regexp_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error);
 
@@ -67,12 +67,10 @@ Gua_Status Array_Intersection(Gua_Object *a, Gua_Object *b, Gua_Object *c, Gua_S
     Gua_Object o2;
     Gua_Integer newKey;
     Gua_Object newObject;
-    Gua_Element *previous;
     Gua_Element *newElement;
     Gua_Short isEqual;
     Gua_String errMessage;
     
-    previous = NULL;
     newElement = NULL;
     newKey = 0;
     
@@ -93,8 +91,8 @@ Gua_Status Array_Intersection(Gua_Object *a, Gua_Object *b, Gua_Object *c, Gua_S
         return GUA_ERROR;
     }
     
-    e1 = (Gua_Element *)Gua_PObjectToArray(a);
-    e2 = (Gua_Element *)Gua_PObjectToArray(b);
+    e1 = (Gua_Element *)Gua_PObjectToElement(a);
+    e2 = (Gua_Element *)Gua_PObjectToElement(b);
     
     if ((e1 != NULL) && (e2 != NULL)) {
         Gua_FreeObject(c);
@@ -146,20 +144,7 @@ Gua_Status Array_Intersection(Gua_Object *a, Gua_Object *b, Gua_Object *c, Gua_S
                         /* The element object. */
                         Gua_LinkObjects(newElement->object, newObject);
                         
-                        if (previous) {
-                            /* Set the target array chain. */
-                            newElement->previous = (struct Gua_Element *)previous;
-                            newElement->next = NULL;
-                            previous->next = (struct Gua_Element *)newElement;
-                        } else {
-                            newElement->previous = NULL;
-                            newElement->next = NULL;
-                            
-                            /* Link the first element. */
-                            Gua_ArrayToPObject(c, (struct Gua_Element *)newElement, 1);
-                        }
-                        
-                        previous = newElement;
+                        Gua_AppendArrayElement(c, newElement);
                         
                         newKey++;
                     }
@@ -168,7 +153,7 @@ Gua_Status Array_Intersection(Gua_Object *a, Gua_Object *b, Gua_Object *c, Gua_S
                 if (e2->next) {
                     e2 = (Gua_Element *)e2->next;
                 } else {            
-                    e2 = (Gua_Element *)Gua_PObjectToArray(b);
+                    e2 = (Gua_Element *)Gua_PObjectToElement(b);
                     break;
                 }
             }
@@ -180,9 +165,6 @@ Gua_Status Array_Intersection(Gua_Object *a, Gua_Object *b, Gua_Object *c, Gua_S
             }
         }
         
-        /* Update the array length entry. */
-        Gua_SetPObjectLength(c, newKey);
-        
         return GUA_OK;
     }
     
@@ -215,13 +197,10 @@ Gua_Status Array_Sort(Gua_Object *target, Gua_Object *source, Gua_Integer order,
     Gua_Object o1;
     Gua_Object o2;
     Gua_Object object;
-    Gua_Element *previous;
-    Gua_Element *p;
-    Gua_Element *n;
+    Gua_Array *a;
     Gua_Integer newKey;
     Gua_String errMessage;
     
-    previous = NULL;
     newKey = 0;
     
     if (Gua_PObjectType(source) != OBJECT_TYPE_ARRAY) {
@@ -233,15 +212,17 @@ Gua_Status Array_Sort(Gua_Object *target, Gua_Object *source, Gua_Integer order,
         return GUA_ERROR;
     }
     
-    if (Gua_PObjectToArray(source) != NULL) {
+    if (Gua_PObjectToElement(source) != NULL) {
         Gua_ClearObject(object);
         
         Gua_CopyArray(&object, source, false);
         
         Gua_FreeObject(target);
         
+        a = (Gua_Array *)Gua_ObjectToArray(object);
+        
         while (true) {
-            e1 = (Gua_Element *)Gua_ObjectToArray(object);
+            e1 = (Gua_Element *)a->first;
             e2 = e1;
             o1 = e1->object;
             
@@ -296,51 +277,18 @@ Gua_Status Array_Sort(Gua_Object *target, Gua_Object *source, Gua_Integer order,
             }
             
             /* Remove the selected element from the source array. */
-            p = (Gua_Element *)e1->previous;
-            n = (Gua_Element *)e1->next;
-            if (p) {
-                p->next = (struct Gua_Element *)n;
-            }
-            if (n) {
-                n->previous = (struct Gua_Element *)p;
-            }
-            if (!p) {
-                if (!n) {
-                    object.array = NULL;
-                } else {
-                    object.array = (struct Gua_Element *)n;
-                }
-            }
-            
-            /* Update the array length entry. */
-            Gua_SetObjectLength(object, Gua_ObjectLength(object) - 1);
+            Gua_RemoveArrayElement(&object, e1);
             
             /* Update the element key. */
             Gua_FreeObject(&(e1->key));
             Gua_IntegerToObject(e1->key, newKey);
             
             /* Insert the selected element in the end of the target array. */
-            if (previous) {
-                /* Set the target array chain. */
-                e1->previous = (struct Gua_Element *)previous;
-                e1->next = NULL;
-                previous->next = (struct Gua_Element *)e1;
-                
-                /* Update the array length entry. */
-                Gua_SetPObjectLength(target, newKey);
-            } else {
-                e1->previous = NULL;
-                e1->next = NULL;
-                
-                /* Link the first element. */
-                Gua_ArrayToPObject(target, (struct Gua_Element *)e1, 1);
-            }
-            
-            previous = e1;
+            Gua_AppendArrayElement(target, e1);
             
             newKey++;
             
-            if (!object.array) {
+            if (!a->first) {
                 break;
             }
         }
@@ -359,10 +307,10 @@ Gua_Status Array_Sort(Gua_Object *target, Gua_Object *source, Gua_Integer order,
  *     C
  *
  * Function:
- *     Gua_Status Array_ArrayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Array_IntersectionFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Array functions wrapper.
+ *     Intersection function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -375,21 +323,9 @@ Gua_Status Array_Sort(Gua_Object *target, Gua_Object *source, Gua_Integer order,
  * Results:
  *     The return object of the wrapped funcion.
  */
-Gua_Status Array_ArrayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Array_IntersectionFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Element *element;
-    Gua_String errMessage;
-    
     Gua_ClearPObject(object);
-
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-        
-        return GUA_ERROR;
-    }
     
     /**
      * Group:
@@ -406,36 +342,41 @@ Gua_Status Array_ArrayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *
      *     b={3,4,5,6}
      *     c=intersection(a,b) # Return {3,4}.
      */
-    if (strcmp(Gua_ObjectToString(argv[0]), "intersection") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_ARRAY) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_ARRAY) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Array_Intersection(&argv[1], &argv[2], object, error) != GUA_OK) {
-            return GUA_ERROR;
-        }
+    if (Array_Intersection(&argv[1], &argv[2], object, error) != GUA_OK) {
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Array_SearchFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Search function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Array_SearchFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Element *element;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -450,57 +391,49 @@ Gua_Status Array_ArrayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *
      *     a={4,1,3,2}
      *     c=search(a,3) # Return 2.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "search") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_ARRAY) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_COMPLEX) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_STRING) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_FILE))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        element = (Gua_Element *)Gua_ObjectToArray(argv[1]);
+    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_COMPLEX) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_STRING) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_FILE))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (element) {
-            while (true) {
-                if ((Gua_ObjectType(element->object) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-                    if (Gua_ObjectToInteger(element->object) == Gua_ObjectToInteger(argv[2])) {
-                        if (Gua_ObjectType(element->key) == OBJECT_TYPE_INTEGER) {
-                            Gua_LinkToPObject(object, element->key);
-                        } else {
-                            Gua_StringToPObject(object, Gua_ObjectToString(element->key));
-                        }
-                        return GUA_OK;
+        return GUA_ERROR;
+    }
+    
+    element = (Gua_Element *)Gua_ObjectToElement(argv[1]);
+    
+    if (element) {
+        while (true) {
+            if ((Gua_ObjectType(element->object) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+                if (Gua_ObjectToInteger(element->object) == Gua_ObjectToInteger(argv[2])) {
+                    if (Gua_ObjectType(element->key) == OBJECT_TYPE_INTEGER) {
+                        Gua_LinkToPObject(object, element->key);
+                    } else {
+                        Gua_StringToPObject(object, Gua_ObjectToString(element->key));
                     }
-                } else if ((Gua_ObjectType(element->object) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-                    if (Gua_ObjectToReal(element->object) == Gua_ObjectToReal(argv[2])) {
-                        if (Gua_ObjectType(element->key) == OBJECT_TYPE_INTEGER) {
-                            Gua_LinkToPObject(object, element->key);
-                        } else {
-                            Gua_StringToPObject(object, Gua_ObjectToString(element->key));
-                        }
-                        return GUA_OK;
+                    return GUA_OK;
+                }
+            } else if ((Gua_ObjectType(element->object) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+                if (Gua_ObjectToReal(element->object) == Gua_ObjectToReal(argv[2])) {
+                    if (Gua_ObjectType(element->key) == OBJECT_TYPE_INTEGER) {
+                        Gua_LinkToPObject(object, element->key);
+                    } else {
+                        Gua_StringToPObject(object, Gua_ObjectToString(element->key));
                     }
-                } else if ((Gua_ObjectType(element->object) == OBJECT_TYPE_COMPLEX) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_COMPLEX)) {
-                    if ((Gua_ObjectToReal(element->object) == Gua_ObjectToReal(argv[2])) && (Gua_ObjectToImaginary(element->object) == Gua_ObjectToImaginary(argv[2]))) {
+                    return GUA_OK;
+                }
+            } else if ((Gua_ObjectType(element->object) == OBJECT_TYPE_COMPLEX) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_COMPLEX)) {
+                if ((Gua_ObjectToReal(element->object) == Gua_ObjectToReal(argv[2])) && (Gua_ObjectToImaginary(element->object) == Gua_ObjectToImaginary(argv[2]))) {
+                    if (Gua_ObjectType(element->key) == OBJECT_TYPE_INTEGER) {
+                        Gua_LinkToPObject(object, element->key);
+                    } else {
+                        Gua_StringToPObject(object, Gua_ObjectToString(element->key));
+                    }
+                    return GUA_OK;
+                }
+            } else if ((Gua_ObjectType(element->object) == OBJECT_TYPE_STRING) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_STRING)) {
+                if (Gua_ObjectLength(element->object) == Gua_ObjectLength(argv[2])) {
+                    if (memcmp(Gua_ObjectToString(element->object), Gua_ObjectToString(argv[2]), Gua_ObjectLength(element->object)) == 0) {
                         if (Gua_ObjectType(element->key) == OBJECT_TYPE_INTEGER) {
                             Gua_LinkToPObject(object, element->key);
                         } else {
@@ -508,84 +441,111 @@ Gua_Status Array_ArrayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *
                         }
                         return GUA_OK;
                     }
-                } else if ((Gua_ObjectType(element->object) == OBJECT_TYPE_STRING) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_STRING)) {
-                    if (Gua_ObjectLength(element->object) == Gua_ObjectLength(argv[2])) {
-                        if (memcmp(Gua_ObjectToString(element->object), Gua_ObjectToString(argv[2]), Gua_ObjectLength(element->object)) == 0) {
-                            if (Gua_ObjectType(element->key) == OBJECT_TYPE_INTEGER) {
-                                Gua_LinkToPObject(object, element->key);
-                            } else {
-                                Gua_StringToPObject(object, Gua_ObjectToString(element->key));
-                            }
-                            return GUA_OK;
-                        }
-                    }
-                }
-                
-                if (element->next) {
-                    element = (Gua_Element *)element->next;
-                } else {
-                    break;
                 }
             }
-        }
-     /**
-     * Group:
-     *     Scripting
-     *
-     * Function:
-     *     sort(array)
-     *
-     * Description:
-     *     Returns a new array containing the elements of the specified array ordered.
-     *
-     * Examples:
-     *     a={2,4,1,3}
-     *     c=sort(a) # Return {1,2,3,4}.
-     */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sort") == 0) {
-        if ((argc < 2) || (argc > 3)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
             
-            return GUA_ERROR;
+            if (element->next) {
+                element = (Gua_Element *)element->next;
+            } else {
+                break;
+            }
         }
+    }
+ /**
+ * Group:
+ *     Scripting
+ *
+ * Function:
+ *     sort(array)
+ *
+ * Description:
+ *     Returns a new array containing the elements of the specified array ordered.
+ *
+ * Examples:
+ *     a={2,4,1,3}
+ *     c=sort(a) # Return {1,2,3,4}.
+ */
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Array_SortFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Sort function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Array_SortFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if ((argc < 2) || (argc > 3)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_ARRAY) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_ARRAY) {
+        return GUA_ERROR;
+    }
+    
+    if (argc == 3) {
+        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
-        
-        if (argc == 3) {
-            if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
+    }
+    
+    if (argc == 2) {
+        if (Array_Sort(object, &argv[1], ARRAY_ASCENDING_ORDER, error) != GUA_OK) {
+            return GUA_ERROR;
         }
-        
-        if (argc == 2) {
-            if (Array_Sort(object, &argv[1], ARRAY_ASCENDING_ORDER, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        } else {
-            if (Array_Sort(object, &argv[1], Gua_ObjectToInteger(argv[2]), error) != GUA_OK) {
-                return GUA_ERROR;
-            }
+    } else {
+        if (Array_Sort(object, &argv[1], Gua_ObjectToInteger(argv[2]), error) != GUA_OK) {
+            return GUA_ERROR;
         }
     }
     
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Array_Functions[] = {
+    {"intersection", Array_IntersectionFunctionWrapper, 3, "aa"},
+    {"search", Array_SearchFunctionWrapper, 3, "a"},
+    {"sort", Array_SortFunctionWrapper, 0, NULL},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -608,29 +568,10 @@ Gua_Status Array_ArrayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *
  */
 Gua_Status Array_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
     
-    Gua_LinkCFunctionToFunction(function, Array_ArrayFunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "intersection", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "intersection");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "search", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "search");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sort", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sort");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Array_Functions, error);
     
     /**
      * Group:
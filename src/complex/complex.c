@@ -44,10 +44,10 @@
  *     C
  *
  * Function:
- *     Gua_Status Complex_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Complex_AbsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Complex functions wrapper.
+ *     Abs function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -60,21 +60,10 @@
  * Results:
  *     The return object of the wrapped funcion.
  */
-Gua_Status Complex_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Complex_AbsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_String errMessage;
-    
     Gua_ClearPObject(object);
     
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-        
-        return GUA_ERROR;
-    }
-    
     /**
      * Group:
      *     Scripting
@@ -85,26 +74,36 @@ Gua_Status Complex_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Obje
      * Description:
      *     Returns the modulus of a complex number.
      */
-    if (strcmp(Gua_ObjectToString(argv[0]), "abs") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_COMPLEX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_RealToPObject(object, (sqrt(Gua_ObjectToReal(argv[1]) * Gua_ObjectToReal(argv[1]) + Gua_ObjectToImaginary(argv[1]) * Gua_ObjectToImaginary(argv[1]))));
+    Gua_RealToPObject(object, (sqrt(Gua_ObjectToReal(argv[1]) * Gua_ObjectToReal(argv[1]) + Gua_ObjectToImaginary(argv[1]) * Gua_ObjectToImaginary(argv[1]))));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Complex_ArgFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Arg function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Complex_ArgFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -115,26 +114,36 @@ Gua_Status Complex_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Obje
      * Description:
      *     Returns the argument of a complex number.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "arg") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_COMPLEX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_RealToPObject(object, (asin(Gua_ObjectToImaginary(argv[1]) / (sqrt(Gua_ObjectToReal(argv[1]) * Gua_ObjectToReal(argv[1]) + Gua_ObjectToImaginary(argv[1]) * Gua_ObjectToImaginary(argv[1]))))));
+    Gua_RealToPObject(object, (asin(Gua_ObjectToImaginary(argv[1]) / (sqrt(Gua_ObjectToReal(argv[1]) * Gua_ObjectToReal(argv[1]) + Gua_ObjectToImaginary(argv[1]) * Gua_ObjectToImaginary(argv[1]))))));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Complex_ConjFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Conj function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Complex_ConjFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -145,26 +154,36 @@ Gua_Status Complex_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Obje
      * Description:
      *     Returns the complex conjugate number.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "conj") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_COMPLEX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_ComplexToPObject(object, Gua_ObjectToReal(argv[1]), -(Gua_ObjectToImaginary(argv[1])));
+    Gua_ComplexToPObject(object, Gua_ObjectToReal(argv[1]), -(Gua_ObjectToImaginary(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Complex_ImagFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Imag function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Complex_ImagFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -179,26 +198,36 @@ Gua_Status Complex_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Obje
      *     a=1.0+2.0*i
      *     c=imag(a) # c contains the value 2.0.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "imag") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_COMPLEX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_RealToPObject(object, Gua_ObjectToImaginary(argv[1]));
+    Gua_RealToPObject(object, Gua_ObjectToImaginary(argv[1]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Complex_RealFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Real function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Complex_RealFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -213,31 +242,21 @@ Gua_Status Complex_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Obje
      *     a=1.0+2.0*i
      *     b=real(a) # b contains the value 1.0.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "real") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_COMPLEX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
-    }
+    Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
     
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Complex_Functions[] = {
+    {"abs", Complex_AbsFunctionWrapper, 2, "c"},
+    {"arg", Complex_ArgFunctionWrapper, 2, "c"},
+    {"conj", Complex_ConjFunctionWrapper, 2, "c"},
+    {"imag", Complex_ImagFunctionWrapper, 2, "c"},
+    {"real", Complex_RealFunctionWrapper, 2, "c"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -260,41 +279,10 @@ Gua_Status Complex_ComplexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Obje
  */
 Gua_Status Complex_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
     
-    Gua_LinkCFunctionToFunction(function, Complex_ComplexFunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "abs", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "abs");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "arg", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "arg");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "conj", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "conj");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "imag", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "imag");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "real", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "real");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Complex_Functions, error);
     
     /**
      * Group:
@@ -377,10 +377,10 @@ Gua_Integer File_Write(Gua_String s, Gua_Integer l, Gua_Integer n, void *h)
  *     C
  *
  * Function:
- *     Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status File_ClearerrFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     File functions wrapper.
+ *     Clearerr function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -393,24 +393,10 @@ Gua_Integer File_Write(Gua_String s, Gua_Integer l, Gua_Integer n, void *h)
  * Results:
  *     Do file operations.
  */
-Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status File_ClearerrFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_File *h;
-    Gua_String buffer;
-    Gua_Integer n;
-    Gua_String errMessage;
-    
     Gua_ClearPObject(object);
     
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-        
-        return GUA_ERROR;
-    }
-    
     /**
      * Group:
      *     Scripting
@@ -421,26 +407,38 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Clears the internal error control variable of file handling.
      */
-    if (strcmp(Gua_ObjectToString(argv[0]), "clearerr") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        File_Clearerr(Gua_ObjectToFile(argv[1]));
+    File_Clearerr(Gua_ObjectToFile(argv[1]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FcloseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fclose function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FcloseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -451,33 +449,43 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Closes the specified file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fclose") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (File_Close(Gua_ObjectToFile(argv[1])) != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not close file");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (File_Close(Gua_ObjectToFile(argv[1])) != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not close file");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FeofFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Feof function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FeofFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -488,26 +496,36 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Returns TRUE if the end of file has been reached.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "feof") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, File_Eof(Gua_ObjectToFile(argv[1])));
+    Gua_IntegerToPObject(object, File_Eof(Gua_ObjectToFile(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FerrorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Ferror function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FerrorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -519,26 +537,38 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      *     Returns the error code occurred accessing the file
      *     indicated by the specified file pointer.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "ferror") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, File_Error(Gua_ObjectToFile(argv[1])));
+    Gua_IntegerToPObject(object, File_Error(Gua_ObjectToFile(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FflushFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fflush function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FflushFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -549,33 +579,45 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Flushes the buffer of the specified file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fflush") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (File_Flush(Gua_ObjectToFile(argv[1])) != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not flush the file buffer");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (File_Flush(Gua_ObjectToFile(argv[1])) != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not flush the file buffer");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FgetsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fgets function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FgetsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String buffer;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -588,32 +630,42 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      *     The newline character is dependent on the underlying operating system: 
      *     UNIX, LF; Windows, CR + LF; MacOS, CR.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fgets") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        buffer = (char *)Gua_Alloc(sizeof(char) * BUFFER_SIZE);
-        
-        if (File_Gets(buffer, BUFFER_SIZE, Gua_ObjectToFile(argv[1])) != NULL) {
-            Gua_StringToPObject(object, buffer);
-        }
-        
-        Gua_Free(buffer);
+    buffer = (char *)Gua_Alloc(sizeof(char) * BUFFER_SIZE);
+    
+    if (File_Gets(buffer, BUFFER_SIZE, Gua_ObjectToFile(argv[1])) != NULL) {
+        Gua_StringToPObject(object, buffer);
+    }
+    
+    Gua_Free(buffer);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FilenoFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fileno function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FilenoFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -624,26 +676,39 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Returns the file indicator for the specified file pointer.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fileno") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, File_Fileno(Gua_ObjectToFile(argv[1])));
+    Gua_IntegerToPObject(object, File_Fileno(Gua_ObjectToFile(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FopenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fopen function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FopenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_File *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -665,59 +730,89 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      *     fputs("Hello World!",h) # Write to the file.
      *     h=fclose(h)             # Close the file, and destroy the variable.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fopen") == 0) {
-        if ((argc < 2) || (argc > 3)) {
+    if ((argc < 2) || (argc > 3)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    if (argc == 2) {
+        h = File_Open(Gua_ObjectToString(argv[1]), "r");
+        
+        if (Gua_GetFileHandle(h) == NULL) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "could not open file", Gua_ObjectToString(argv[1]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
+    } else {
+        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
         
-        if (argc == 2) {
-            h = File_Open(Gua_ObjectToString(argv[1]), "r");
-            
-            if (Gua_GetFileHandle(h) == NULL) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "could not open file", Gua_ObjectToString(argv[1]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        } else {
-            if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            
-            h = File_Open(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]));
+        h = File_Open(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]));
+        
+        if (Gua_GetFileHandle(h) == NULL) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "could not open file", Gua_ObjectToString(argv[1]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
             
-            if (Gua_GetFileHandle(h) == NULL) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "could not open file", Gua_ObjectToString(argv[1]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
+            return GUA_ERROR;
         }
+    }
 
-        Gua_FileToPObject(object, (struct Gua_File *)h);
+    Gua_FileToPObject(object, (struct Gua_File *)h);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FputsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fputs function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FputsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -729,41 +824,46 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      *     Writes the specified string in the file and includes a
      *     newline character to the end of it.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fputs") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (File_Puts(Gua_ObjectToString(argv[1]), Gua_ObjectToFile(argv[2])) < 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not write to file");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (File_Puts(Gua_ObjectToString(argv[1]), Gua_ObjectToFile(argv[2])) < 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not write to file");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FreadFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fread function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FreadFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String buffer;
+    Gua_Integer n;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -774,41 +874,45 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Reads n characters from the file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fread") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        buffer = (char *)Gua_Alloc(sizeof(char) * (Gua_ObjectToInteger(argv[1]) + 1));
-        memset(buffer, '\0', Gua_ObjectToInteger(argv[1]) + 1);
-        
-        n = File_Read(buffer, sizeof(char), Gua_ObjectToInteger(argv[1]), Gua_ObjectToFile(argv[2]));
-        
-        Gua_ByteArrayToPObject(object, buffer, n);
-        
-        Gua_Free(buffer);
+    buffer = (char *)Gua_Alloc(sizeof(char) * (Gua_ObjectToInteger(argv[1]) + 1));
+    memset(buffer, '\0', Gua_ObjectToInteger(argv[1]) + 1);
+    
+    n = File_Read(buffer, sizeof(char), Gua_ObjectToInteger(argv[1]), Gua_ObjectToFile(argv[2]));
+    
+    Gua_ByteArrayToPObject(object, buffer, n);
+    
+    Gua_Free(buffer);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FseekFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fseek function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FseekFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -822,48 +926,43 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      *     SEEK_SET, for the beginning of the file; SEEK_CUR, for the current
      *     position in the file and SEEK_END, for the end of the file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fseek") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (File_Seek(Gua_ObjectToFile(argv[1]), Gua_ObjectToInteger(argv[2]), Gua_ObjectToInteger(argv[3])) != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %ld\n", "could not set file position to ", Gua_ObjectToInteger(argv[2]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (File_Seek(Gua_ObjectToFile(argv[1]), Gua_ObjectToInteger(argv[2]), Gua_ObjectToInteger(argv[3])) != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %ld\n", "could not set file position to ", Gua_ObjectToInteger(argv[2]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FtellFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Ftell function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FtellFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -874,26 +973,38 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Returns the current position in the file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "ftell") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, File_Tell(Gua_ObjectToFile(argv[1])));
+    Gua_IntegerToPObject(object, File_Tell(Gua_ObjectToFile(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_FwriteFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fwrite function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_FwriteFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -904,41 +1015,46 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Writes the specified string in the file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fwrite") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (File_Write(Gua_ObjectToString(argv[1]), sizeof(char), Gua_ObjectLength(argv[1]), Gua_ObjectToFile(argv[2])) < 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not write to file");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (File_Write(Gua_ObjectToString(argv[1]), sizeof(char), Gua_ObjectLength(argv[1]), Gua_ObjectToFile(argv[2])) < 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not write to file");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_GetcharFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Getchar function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_GetcharFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String buffer;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -949,71 +1065,114 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Reads the next character of stdin.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "getchar") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        buffer = (char *)Gua_Alloc(sizeof(char) * 2);
-        
-        if (!(buffer[0] = getchar())) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not read from file");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            Gua_Free(buffer);
-            
-            return GUA_ERROR;
-        }
-        buffer[1] = '\0';
-        
-        Gua_StringToPObject(object, buffer);
+    buffer = (char *)Gua_Alloc(sizeof(char) * 2);
+    
+    if (!(buffer[0] = getchar())) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not read from file");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
         Gua_Free(buffer);
+        
+        return GUA_ERROR;
+    }
+    buffer[1] = '\0';
+    
+    Gua_StringToPObject(object, buffer);
+    
+    Gua_Free(buffer);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_GetsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Gets function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_GetsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String buffer;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
      *
      * Function:
      *     gets()
-     *
-     * Description:
-     *     Reads a string from the console to find a newline character.
-     *     The newline character is dependent on the underlying operating system:
-     *     UNIX, LF; Windows, CR + LF, MacOS, CR.
-     */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "gets") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        buffer = (char *)Gua_Alloc(sizeof(char) * BUFFER_SIZE);
+     *
+     * Description:
+     *     Reads a string from the console to find a newline character.
+     *     The newline character is dependent on the underlying operating system:
+     *     UNIX, LF; Windows, CR + LF, MacOS, CR.
+     */
+    buffer = (char *)Gua_Alloc(sizeof(char) * BUFFER_SIZE);
+    
+    if (!fgets(buffer, BUFFER_SIZE, stdin)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not read from file");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (!fgets(buffer, BUFFER_SIZE, stdin)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not read from file");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            Gua_Free(buffer);
-            
-            return GUA_ERROR;
-        }
+        Gua_Free(buffer);
         
-        Gua_StringToPObject(object, buffer);
+        return GUA_ERROR;
+    }
+    
+    Gua_StringToPObject(object, buffer);
 
-        Gua_Free(buffer);
+    Gua_Free(buffer);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_PutcharFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Putchar function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_PutcharFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1024,42 +1183,54 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *     Write a character to stdout.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "putchar") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (Gua_ObjectLength(argv[1]) != 1) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not put more than one character at time");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectLength(argv[1]) != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not put more than one character at time");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    if (putchar(Gua_ObjectToString(argv[1])[0]) < 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not write to file");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (putchar(Gua_ObjectToString(argv[1])[0]) < 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not write to file");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_PutsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Puts function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_PutsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1071,33 +1242,45 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      *     Write the specified string in the console and includes a
      *     newline character to the end of it.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "puts") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (puts(Gua_ObjectToString(argv[1])) < 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not write to file");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (puts(Gua_ObjectToString(argv[1])) < 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not write to file");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status File_RewindFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Rewind function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Do file operations.
+ */
+Gua_Status File_RewindFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1108,38 +1291,43 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
      * Description:
      *      Returns the read / write pointer to the beginning of the file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "rewind") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        File_Rewind(Gua_ObjectToFile(argv[1]));
-    } else {
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_FILE) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "unknown function", Gua_ObjectToString(argv[0]));
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
         
         return GUA_ERROR;
     }
     
+    File_Rewind(Gua_ObjectToFile(argv[1]));
+    
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry File_Functions[] = {
+    {"clearerr", File_ClearerrFunctionWrapper, 2, "f"},
+    {"fclose", File_FcloseFunctionWrapper, 2, "f"},
+    {"feof", File_FeofFunctionWrapper, 2, "f"},
+    {"ferror", File_FerrorFunctionWrapper, 2, "f"},
+    {"fflush", File_FflushFunctionWrapper, 2, "f"},
+    {"fgets", File_FgetsFunctionWrapper, 2, "f"},
+    {"fileno", File_FilenoFunctionWrapper, 2, "f"},
+    {"fopen", File_FopenFunctionWrapper, 0, NULL},
+    {"fputs", File_FputsFunctionWrapper, 3, "sf"},
+    {"fread", File_FreadFunctionWrapper, 3, "if"},
+    {"fseek", File_FseekFunctionWrapper, 4, "fii"},
+    {"ftell", File_FtellFunctionWrapper, 2, "f"},
+    {"fwrite", File_FwriteFunctionWrapper, 3, "sf"},
+    {"getchar", File_GetcharFunctionWrapper, 1, NULL},
+    {"gets", File_GetsFunctionWrapper, 1, NULL},
+    {"putchar", File_PutcharFunctionWrapper, 2, "s"},
+    {"puts", File_PutsFunctionWrapper, 2, "s"},
+    {"rewind", File_RewindFunctionWrapper, 2, NULL},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -1163,119 +1351,10 @@ Gua_Status File_FileFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
 Gua_Status File_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
     Gua_File *h;
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
     
-    Gua_LinkCFunctionToFunction(function, File_FileFunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "clearerr", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "clearerr");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fclose", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fclose");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "feof", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "feof");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "ferror", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "ferror");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fflush", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fflush");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fgets", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fgets");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fileno", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fileno");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fopen", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fopen");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fputs", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fputs");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fread", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fread");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fseek", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fseek");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "ftell", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "ftell");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fwrite", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fwrite");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "getchar", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "getchar");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gets", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gets");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "putchar", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "putchar");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "puts", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "puts");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "rewind", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "rewind");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, File_Functions, error);
     
     /**
      * Group:
@@ -216,7 +216,7 @@ void Fs_Extension(Gua_String file, Gua_String *extension)
             }
             
             /* Get the file name. */
-            newString = (Gua_String)malloc(sizeof(Gua_Char) * strlen(file) + 1);
+            newString = (Gua_String)Gua_Alloc(sizeof(Gua_Char) * strlen(file) + 1);
             k = 0;
             for (j = i; j < strlen(file); j++) {
                 newString[k] = file[j];
@@ -224,11 +224,11 @@ void Fs_Extension(Gua_String file, Gua_String *extension)
             }
             newString[k] = '\0';
         } else {
-            newString = (Gua_String)malloc(sizeof(Gua_Char));
+            newString = (Gua_String)Gua_Alloc(sizeof(Gua_Char));
             newString[0] = '\0';
         }
     } else {
-        newString = (Gua_String)malloc(sizeof(Gua_Char));
+        newString = (Gua_String)Gua_Alloc(sizeof(Gua_Char));
         newString[0] = '\0';
     }
     
@@ -262,13 +262,13 @@ void Fs_FullPath(Gua_String file, Gua_String *path)
     
     /* Convert Windows path to Unix path. */
     if (realPath != NULL) {
-        unixPath = (Gua_String)malloc(sizeof(Gua_Char) * strlen(realPath) + 1);
+        unixPath = (Gua_String)Gua_Alloc(sizeof(Gua_Char) * strlen(realPath) + 1);
         for (i = 0; i < strlen(realPath); i++) {
             unixPath[i] = realPath[i] == '\\' ? '/' : realPath[i];
         }
         unixPath[i] = '\0';
         
-        Gua_Free(realPath);
+        free(realPath);
         
         *path = unixPath;
     }
@@ -463,7 +463,6 @@ Gua_Status Fs_List(Gua_String directory, Gua_Object *list, Gua_String error)
     Gua_Short i;
     DIR *dirPointer;
     struct dirent *dirEntry;
-    Gua_Element *previous;
     Gua_Element *newElement;
     Gua_String errMessage;
     
@@ -480,44 +479,18 @@ Gua_Status Fs_List(Gua_String directory, Gua_Object *list, Gua_String error)
         i = 0;
         
         while ((dirEntry = readdir(dirPointer)) != NULL) {
-            if (i == 0) {
-                /* Create the first element. */
-                newElement = (Gua_Element *)Gua_Alloc(sizeof(Gua_Element));
-                /* The element key. */
-                Gua_IntegerToObject(newElement->key, i);
-                /* The element object. */
-                Gua_StringToObject(newElement->object, dirEntry->d_name);
-                
-                /* Set the target array chain. */
-                newElement->previous = NULL;
-                newElement->next = NULL;
-                
-                /* Link the first element. */
-                Gua_ArrayToPObject(list, (struct Gua_Element *)newElement, 1);
-                
-                previous = (Gua_Element *)Gua_PObjectToArray(list);
-            } else {
-                /* Create a new element. */
-                newElement = (Gua_Element *)Gua_Alloc(sizeof(Gua_Element));
-                /* The element key. */
-                Gua_IntegerToObject(newElement->key, i);
-                /* The element object. */
-                Gua_StringToObject(newElement->object, dirEntry->d_name);
-                
-                /* Set the target array chain. */
-                newElement->previous = (struct Gua_Element *)previous;
-                newElement->next = NULL;
-                
-                previous->next = (struct Gua_Element *)newElement;
-                previous = newElement;
-            }
+            /* Create a new element. */
+            newElement = (Gua_Element *)Gua_Alloc(sizeof(Gua_Element));
+            /* The element key. */
+            Gua_IntegerToObject(newElement->key, i);
+            /* The element object. */
+            Gua_StringToObject(newElement->object, dirEntry->d_name);
+            
+            Gua_AppendArrayElement(list, newElement);
             
             i++;
         }
         
-        /* Update the array length entry. */
-        Gua_SetPObjectLength(list, i);
-        
         closedir(dirPointer);
     }
     
@@ -595,7 +568,7 @@ void Fs_Name(Gua_String file, Gua_String *name)
         }
         
         /* Get the file name. */
-        newString = (Gua_String)malloc(sizeof(Gua_Char) * strlen(file) + 1);
+        newString = (Gua_String)Gua_Alloc(sizeof(Gua_Char) * strlen(file) + 1);
         k = 0;
         for (j = i; j < strlen(file); j++) {
             newString[k] = file[j];
@@ -603,7 +576,7 @@ void Fs_Name(Gua_String file, Gua_String *name)
         }
         newString[k] = '\0';
     } else {
-        newString = (Gua_String)malloc(sizeof(Gua_Char));
+        newString = (Gua_String)Gua_Alloc(sizeof(Gua_Char));
         newString[0] = '\0';
     }
     
@@ -642,13 +615,13 @@ void Fs_Path(Gua_String file, Gua_String *path)
         }
         
         /* Get the file path. */
-        newString = (Gua_String)malloc(sizeof(Gua_Char) * strlen(file) + 1);
+        newString = (Gua_String)Gua_Alloc(sizeof(Gua_Char) * strlen(file) + 1);
         for (j = 0; j < i; j++) {
             newString[j] = file[j];
         }
         newString[j] = '\0';
     } else {
-        newString = (Gua_String)malloc(sizeof(Gua_Char));
+        newString = (Gua_String)Gua_Alloc(sizeof(Gua_Char));
         newString[0] = '\0';
     }
     
@@ -758,10 +731,10 @@ Gua_Real Fs_Time(Gua_String file)
  *     C
  *
  * Function:
- *     Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Fs_FsCopyFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     FsCopy function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -774,22 +747,10 @@ Gua_Real Fs_Time(Gua_String file)
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Fs_FsCopyFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_String newString;
-    Gua_String errMessage;
-    
     Gua_ClearPObject(object);
     
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-
-        return GUA_ERROR;
-    }
-    
     /**
      * Group:
      *     Scripting
@@ -800,34 +761,34 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Copy (binary) source file to target file.
      */
-    if (strcmp(Gua_ObjectToString(argv[0]), "fsCopy") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        return Fs_Copy(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]), error);
+    return Fs_Copy(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]), error);
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsDeleteFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsDelete function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsDeleteFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -838,26 +799,34 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Delete the specified file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsDelete") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        return Fs_Delete(Gua_ObjectToString(argv[1]), error);
+    return Fs_Delete(Gua_ObjectToString(argv[1]), error);
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsExistsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsExists function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsExistsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -868,26 +837,38 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return TRUE if the specified file exists.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsExists") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Fs_Exists(Gua_ObjectToString(argv[1])));
+    Gua_IntegerToPObject(object, Fs_Exists(Gua_ObjectToString(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsExtensionFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsExtension function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsExtensionFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String newString;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -898,30 +879,42 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return the file name extension.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsExtension") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Fs_Extension(Gua_ObjectToString(argv[1]), &newString);
-        
-        Gua_StringToPObject(object, newString);
-        
-        Gua_Free(newString);
+    Fs_Extension(Gua_ObjectToString(argv[1]), &newString);
+    
+    Gua_StringToPObject(object, newString);
+    
+    Gua_Free(newString);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsFullPathFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsFullPath function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsFullPathFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String newString;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -932,30 +925,40 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return the full path for the specified file name.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsFullPath") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Fs_FullPath(Gua_ObjectToString(argv[1]), &newString);
-        
-        Gua_StringToPObject(object, newString);
-        
-        Gua_Free(newString);
+    Fs_FullPath(Gua_ObjectToString(argv[1]), &newString);
+    
+    Gua_StringToPObject(object, newString);
+    
+    Gua_Free(newString);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsIsDirectoryFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsIsDirectory function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsIsDirectoryFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -966,56 +969,76 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return TRUE if the specified file is a directory.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsIsDirectory") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Fs_IsDirectory(Gua_ObjectToString(argv[1])));
-    /**
-     * Group:
-     *     Scripting
-     *
-     * Function:
-     *     fsIsExecutable(file)
-     *
-     * Description:
-     *     Return TRUE if the specified file is a program.
-     */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsIsExecutable") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Fs_IsExecutable(Gua_ObjectToString(argv[1])));
+    Gua_IntegerToPObject(object, Fs_IsDirectory(Gua_ObjectToString(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsIsExecutableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsIsExecutable function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsIsExecutableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    /**
+     * Group:
+     *     Scripting
+     *
+     * Function:
+     *     fsIsExecutable(file)
+     *
+     * Description:
+     *     Return TRUE if the specified file is a program.
+     */
+    Gua_IntegerToPObject(object, Fs_IsExecutable(Gua_ObjectToString(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsIsReadableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsIsReadable function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsIsReadableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1026,26 +1049,36 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return TRUE if the specified file is readable.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsIsReadable") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Fs_IsReadable(Gua_ObjectToString(argv[1])));
+    Gua_IntegerToPObject(object, Fs_IsReadable(Gua_ObjectToString(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsIsWritableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsIsWritable function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsIsWritableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1056,26 +1089,36 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return TRUE if the specified file is writable.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsIsWritable") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Fs_IsWritable(Gua_ObjectToString(argv[1])));
+    Gua_IntegerToPObject(object, Fs_IsWritable(Gua_ObjectToString(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsLinkFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsLink function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsLinkFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1086,34 +1129,36 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Create a symbolic link from source to target.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsLink") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Fs_Link(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2])));
+    Gua_IntegerToPObject(object, Fs_Link(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsList function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1124,26 +1169,34 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return the list of files in the specified directory.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsList") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        return Fs_List(Gua_ObjectToString(argv[1]), object, error);
+    return Fs_List(Gua_ObjectToString(argv[1]), object, error);
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsMkDirFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsMkDir function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsMkDirFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1154,60 +1207,84 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Create the specified directory.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsMkDir") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Fs_MkDir(Gua_ObjectToString(argv[1])));
-    /**
-     * Group:
-     *     Scripting
-     *
-     * Function:
-     *     fsName(path)
-     *
-     * Description:
-     *     Return the file name without the file path.
-     */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsName") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Fs_Name(Gua_ObjectToString(argv[1]), &newString);
-        
-        Gua_StringToPObject(object, newString);
-        
-        Gua_Free(newString);
+    Gua_IntegerToPObject(object, Fs_MkDir(Gua_ObjectToString(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsNameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsName function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsNameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String newString;
+    
+    Gua_ClearPObject(object);
+    
+    /**
+     * Group:
+     *     Scripting
+     *
+     * Function:
+     *     fsName(path)
+     *
+     * Description:
+     *     Return the file name without the file path.
+     */
+    Fs_Name(Gua_ObjectToString(argv[1]), &newString);
+    
+    Gua_StringToPObject(object, newString);
+    
+    Gua_Free(newString);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsPathFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsPath function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsPathFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String newString;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1218,30 +1295,40 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return the file path without the file name.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsPath") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Fs_Path(Gua_ObjectToString(argv[1]), &newString);
-        
-        Gua_StringToPObject(object, newString);
-        
-        Gua_Free(newString);
+    Fs_Path(Gua_ObjectToString(argv[1]), &newString);
+    
+    Gua_StringToPObject(object, newString);
+    
+    Gua_Free(newString);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsRenameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsRename function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsRenameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1252,34 +1339,34 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Delete the specified file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsRename") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        return Fs_Rename(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]), error);
+    return Fs_Rename(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]), error);
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsSize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1290,26 +1377,36 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return the file size.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsSize") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Fs_Size(Gua_ObjectToString(argv[1])));
+    Gua_IntegerToPObject(object, Fs_Size(Gua_ObjectToString(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Fs_FsTimeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     FsTime function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Fs_FsTimeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -1320,31 +1417,33 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
      * Description:
      *     Return the modification time of the specified file.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fsTime") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_RealToPObject(object, Fs_Time(Gua_ObjectToString(argv[1])));
-    }
-
+    Gua_RealToPObject(object, Fs_Time(Gua_ObjectToString(argv[1])));
+    
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Fs_Functions[] = {
+    {"fsCopy", Fs_FsCopyFunctionWrapper, 3, "ss"},
+    {"fsDelete", Fs_FsDeleteFunctionWrapper, 2, "s"},
+    {"fsExists", Fs_FsExistsFunctionWrapper, 2, "s"},
+    {"fsExtension", Fs_FsExtensionFunctionWrapper, 2, "s"},
+    {"fsFullPath", Fs_FsFullPathFunctionWrapper, 2, "s"},
+    {"fsIsDirectory", Fs_FsIsDirectoryFunctionWrapper, 2, "s"},
+    {"fsIsExecutable", Fs_FsIsExecutableFunctionWrapper, 2, "s"},
+    {"fsIsReadable", Fs_FsIsReadableFunctionWrapper, 2, "s"},
+    {"fsIsWritable", Fs_FsIsWritableFunctionWrapper, 2, "s"},
+    {"fsLink", Fs_FsLinkFunctionWrapper, 3, "ss"},
+    {"fsList", Fs_FsListFunctionWrapper, 2, "s"},
+    {"fsMkDir", Fs_FsMkDirFunctionWrapper, 2, "s"},
+    {"fsName", Fs_FsNameFunctionWrapper, 2, "s"},
+    {"fsPath", Fs_FsPathFunctionWrapper, 2, "s"},
+    {"fsRename", Fs_FsRenameFunctionWrapper, 3, "ss"},
+    {"fsSize", Fs_FsSizeFunctionWrapper, 2, "s"},
+    {"fsTime", Fs_FsTimeFunctionWrapper, 2, "s"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -1367,130 +1466,11 @@ Gua_Status Fs_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
  */
 Gua_Status Fs_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
 
     /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsCopy", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsCopy");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsDelete", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsDelete");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsExists", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsExists");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsExtension", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsExtension");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsFullPath", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsFullPath");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsIsDirectory", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsIsDirectory");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsIsExecutable", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsIsExecutable");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsIsReadable", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsIsReadable");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsIsWritable", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsIsWritable");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsLink", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsLink");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsList", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsList");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsMkDir", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsMkDir");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsName", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsName");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsPath", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsPath");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsRename", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsRename");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsSize", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsSize");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Fs_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fsTime", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fsTime");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Fs_Functions, error);
     
     /**
      * Group:
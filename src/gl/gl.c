@@ -48,10 +48,10 @@
  *     C
  *
  * Function:
- *     Gua_Status Gl_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Gl_GlAlphaFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     GlAlphaFunc function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -64,37 +64,158 @@
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Gl_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Gl_GlAlphaFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
     GLint arg1i;
-    GLint arg2i;
-    GLint arg3i;
-    GLint arg4i;
-    GLint arg5i;
-    GLint arg6i;
-    GLint arg7i;
-    GLint arg8i;
-    GLdouble arg1f;
     GLdouble arg2f;
-    GLdouble arg3f;
-    GLdouble arg4f;
-    GLdouble arg5f;
-    GLdouble arg6f;
-    GLdouble arg1d;
-    GLbyte *arg1bv;
-    GLbyte *arg4bv;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    arg2f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    }
+    
+    glAlphaFunc(arg1i, arg2f);
+    
+    return GUA_OK;
+}
+
 #ifndef _WINDOWS_
-    GLbyte *arg8bv;
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlActiveTextureFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlActiveTexture function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlActiveTextureFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glActiveTexture(arg1i);
+    
+    return GUA_OK;
+}
 #endif
-    GLbyte *arg9bv;
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlArrayOfByteFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlArrayOfByte function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlArrayOfByteFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLbyte *arg1bv;
+    Gua_Handle *h;
+    Gua_Length i;
+    Gua_Length l;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    i = 0;
+    l = 0;
+    
+	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_STRING)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    l = Gua_ObjectLength(argv[1]);
+    
+    arg1bv = (GLbyte *)malloc(sizeof(GLbyte) * l + 1);
+    
+    for (i = 0; i < l; i++) {
+        arg1bv[i] = argv[1].string[i];
+    }
+    arg1bv[l] = '\0';
+    
+    Gua_NewHandle(h, "glArrayOfByte", arg1bv);
+    
+    Gua_HandleToPObject(object, (struct Gua_Handle *)h);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlArrayOfIntFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlArrayOfInt function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlArrayOfIntFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
     GLuint *arg1iv;
-    GLuint *arg2iv;
-    GLfloat *arg1fv;
-    GLfloat *arg2fv;
-    GLfloat *arg3fv;
-    GLfloat *arg4fv;
-    GLdouble *arg2dv;
-    const GLubyte *resbv;
     Gua_Handle *h;
     Gua_Length i;
     Gua_Length l;
@@ -104,4001 +225,2032 @@ Gua_Status Gl_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
     
     Gua_ClearPObject(object);
     
-    arg1i = 0;
-    arg2i = 0;
-    arg3i = 0;
-    arg4i = 0;
-    arg5i = 0;
-    arg6i = 0;
-    arg7i = 0;
-    arg8i = 0;
+    i = 0;
+    l = 0;
     
-    arg1f = 0.0;
-    arg2f = 0.0;
-    arg3f = 0.0;
-    arg4f = 0.0;
-    arg5f = 0.0;
-    arg6f = 0.0;
+	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_MATRIX)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
     
-    arg1d = 0.0;
+    m = (Gua_Matrix *)Gua_ObjectToMatrix(argv[1]);
+    o = (Gua_Object *)m->object;
+    
+    l = Gua_ObjectLength(argv[1]);
+    
+    arg1iv = (GLuint *)malloc(sizeof(GLuint) * l);
+    
+    for (i = 0; i < l; i++) {
+        if (Gua_ObjectType(o[i]) == OBJECT_TYPE_INTEGER) {
+            arg1iv[i] = Gua_ObjectToInteger(o[i]);
+        } else if (Gua_ObjectType(o[i]) == OBJECT_TYPE_REAL) {
+            arg1iv[i] = roundl(Gua_ObjectToReal(o[i]));
+        } else {
+            arg1iv[i] = 0.0;
+        }
+    }
+    
+    Gua_NewHandle(h, "glArrayOfInt", arg1iv);
+    
+    Gua_HandleToPObject(object, (struct Gua_Handle *)h);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlArrayOfFloatFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlArrayOfFloat function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlArrayOfFloatFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLfloat *arg1fv;
+    Gua_Handle *h;
+    Gua_Length i;
+    Gua_Length l;
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
     
     i = 0;
     l = 0;
     
-    if (argc == 0) {
+	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_MATRIX)) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
-
+        
         return GUA_ERROR;
     }
-
-    if (strcmp(Gua_ObjectToString(argv[0]), "glAlphaFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+    
+    m = (Gua_Matrix *)Gua_ObjectToMatrix(argv[1]);
+    o = (Gua_Object *)m->object;
+    
+    l = Gua_ObjectLength(argv[1]);
+    
+    arg1fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
+    
+    for (i = 0; i < l; i++) {
+        if (Gua_ObjectType(o[i]) == OBJECT_TYPE_INTEGER) {
+            arg1fv[i] = Gua_ObjectToInteger(o[i]);
+        } else if (Gua_ObjectType(o[i]) == OBJECT_TYPE_REAL) {
+            arg1fv[i] = Gua_ObjectToReal(o[i]);
+        } else {
+            arg1fv[i] = 0.0;
         }
+    }
+    
+    Gua_NewHandle(h, "glArrayOfFloat", arg1fv);
+    
+    Gua_HandleToPObject(object, (struct Gua_Handle *)h);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        
-        glAlphaFunc(arg1i, arg2f);
-#ifndef _WINDOWS_
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glActiveTexture") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glActiveTexture(arg1i);
-#endif
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glArrayOfByte") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_STRING)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        l = Gua_ObjectLength(argv[1]);
-        
-        arg1bv = (GLbyte *)malloc(sizeof(GLbyte) * l + 1);
-        
-        for (i = 0; i < l; i++) {
-            arg1bv[i] = argv[1].string[i];
-        }
-        arg1bv[l] = '\0';
-        
-        Gua_NewHandle(h, "glArrayOfByte", arg1bv);
-        
-        Gua_HandleToPObject(object, (struct Gua_Handle *)h);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glArrayOfInt") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_MATRIX)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        m = (Gua_Matrix *)Gua_ObjectToMatrix(argv[1]);
-        o = (Gua_Object *)m->object;
-        
-        l = Gua_ObjectLength(argv[1]);
-        
-        arg1iv = (GLuint *)malloc(sizeof(GLuint) * l);
-        
-        for (i = 0; i < l; i++) {
-            if (Gua_ObjectType(o[i]) == OBJECT_TYPE_INTEGER) {
-                arg1iv[i] = Gua_ObjectToInteger(o[i]);
-            } else if (Gua_ObjectType(o[i]) == OBJECT_TYPE_REAL) {
-                arg1iv[i] = roundl(Gua_ObjectToReal(o[i]));
-            } else {
-                arg1iv[i] = 0.0;
-            }
-        }
-        
-        Gua_NewHandle(h, "glArrayOfInt", arg1iv);
-        
-        Gua_HandleToPObject(object, (struct Gua_Handle *)h);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glArrayOfFloat") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_MATRIX)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        m = (Gua_Matrix *)Gua_ObjectToMatrix(argv[1]);
-        o = (Gua_Object *)m->object;
-        
-        l = Gua_ObjectLength(argv[1]);
-        
-        arg1fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
-        
-        for (i = 0; i < l; i++) {
-            if (Gua_ObjectType(o[i]) == OBJECT_TYPE_INTEGER) {
-                arg1fv[i] = Gua_ObjectToInteger(o[i]);
-            } else if (Gua_ObjectType(o[i]) == OBJECT_TYPE_REAL) {
-                arg1fv[i] = Gua_ObjectToReal(o[i]);
-            } else {
-                arg1fv[i] = 0.0;
-            }
-        }
-        
-        Gua_NewHandle(h, "glArrayOfFloat", arg1fv);
-        
-        Gua_HandleToPObject(object, (struct Gua_Handle *)h);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glBegin") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glBegin(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glBindBuffer") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glBindTexture") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlBeginFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlBegin function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlBeginFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glBegin(arg1i);
+    
+    return GUA_OK;
+}
 
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glBindTexture(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glBlendFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlBindBufferFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlBindBuffer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlBindBufferFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
 
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glBlendFunc(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glBufferData") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glBufferSubData") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glCallList") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlBindTextureFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlBindTexture function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlBindTextureFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    glBindTexture(arg1i, arg2i);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glCallList(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glClear") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlBlendFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlBlendFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlBlendFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    glBlendFunc(arg1i, arg2i);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glClear(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glClearColor") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlBufferDataFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlBufferData function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlBufferDataFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlBufferSubDataFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlBufferSubData function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlBufferSubDataFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
 
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4f = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4f = Gua_ObjectToReal(argv[4]);            
-        }
-        
-        glClearColor(arg1f, arg2f, arg3f, arg4f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glClearDepth") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlCallListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlCallList function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlCallListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glCallList(arg1i);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        
-        glClearDepth(arg1f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glClearStencil") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlClearFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlClear function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlClearFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glClear(arg1i);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glClearStencil(arg1i);
-#ifndef _WINDOWS_
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glClientActiveTexture") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlClearColorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlClearColor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlClearColorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    GLdouble arg4f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    arg4f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4f = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4f = Gua_ObjectToReal(argv[4]);            
+    }
+    
+    glClearColor(arg1f, arg2f, arg3f, arg4f);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glClientActiveTexture(arg1i);
-#endif
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glClipPlane") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glColor") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlClearDepthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlClearDepth function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlClearDepthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
+    }
+    
+    glClearDepth(arg1f);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlClearStencilFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlClearStencil function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlClearStencilFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glClearStencil(arg1i);
+    
+    return GUA_OK;
+}
 
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4f = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4f = Gua_ObjectToReal(argv[4]);            
-        }
-        
-        glColor4f(arg1f, arg2f, arg3f, arg4f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glColorMask") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+#ifndef _WINDOWS_
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlClientActiveTextureFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlClientActiveTexture function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlClientActiveTextureFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glClientActiveTexture(arg1i);
+    
+    return GUA_OK;
+}
+#endif
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        
-        glColorMask(arg1i, arg2i, arg3i, arg4i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glColorMaterial") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlClipPlaneFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlClipPlane function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlClipPlaneFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-		if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlColorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlColor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlColorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    GLdouble arg4f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    arg4f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4f = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4f = Gua_ObjectToReal(argv[4]);            
+    }
+    
+    glColor4f(arg1f, arg2f, arg3f, arg4f);
+    
+    return GUA_OK;
+}
 
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glColorMaterial(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glColorPointer") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlColorMaskFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlColorMask function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlColorMaskFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLint arg4i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
+    }
+    
+    glColorMask(arg1i, arg2i, arg3i, arg4i);
+    
+    return GUA_OK;
+}
 
-	    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!(Gua_ObjectType(argv[4]) == OBJECT_TYPE_HANDLE)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        /*
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        */
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlColorMaterialFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlColorMaterial function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlColorMaterialFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    glColorMaterial(arg1i, arg2i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlColorPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlColorPointer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlColorPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg3i;
+    GLfloat *arg4fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg3i = 0;
+    
+    if (!(Gua_ObjectType(argv[4]) == OBJECT_TYPE_HANDLE)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    /*
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    */
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg4fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glColorPointer(arg1i, GL_FLOAT, arg3i, arg4fv);
-#ifndef _WINDOWS_
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glCompressedTexImage2D") == 0) {
-        if (argc != 9) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 7 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[8]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5i = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5i = roundl(Gua_ObjectToReal(argv[5]));            
-        }
-        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-            arg6i = Gua_ObjectToInteger(argv[6]);
-        } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
-            arg6i = roundl(Gua_ObjectToReal(argv[6]));            
-        }
-        if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
-            arg7i = Gua_ObjectToInteger(argv[7]);
-        } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
-            arg7i = roundl(Gua_ObjectToReal(argv[7]));            
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[8]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg8bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glCompressedTexImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8bv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glCompressedTexSubImage2D") == 0) {
-        if (argc != 10) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg4fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glColorPointer(arg1i, GL_FLOAT, arg3i, arg4fv);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 7 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[9]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5i = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5i = roundl(Gua_ObjectToReal(argv[5]));            
-        }
-        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-            arg6i = Gua_ObjectToInteger(argv[6]);
-        } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
-            arg6i = roundl(Gua_ObjectToReal(argv[6]));            
-        }
-        if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
-            arg7i = Gua_ObjectToInteger(argv[7]);
-        } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
-            arg7i = roundl(Gua_ObjectToReal(argv[7]));            
-        }
-        if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
-            arg8i = Gua_ObjectToInteger(argv[8]);
-        } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
-            arg8i = roundl(Gua_ObjectToReal(argv[8]));            
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[9]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg9bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
+#ifndef _WINDOWS_
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlCompressedTexImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlCompressedTexImage2D function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlCompressedTexImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLint arg4i;
+    GLint arg5i;
+    GLint arg6i;
+    GLint arg7i;
+#ifndef _WINDOWS_
+    GLbyte *arg8bv;
+#endif
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    arg5i = 0;
+    arg6i = 0;
+    arg7i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5i = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5i = roundl(Gua_ObjectToReal(argv[5]));            
+    }
+    if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+        arg6i = Gua_ObjectToInteger(argv[6]);
+    } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
+        arg6i = roundl(Gua_ObjectToReal(argv[6]));            
+    }
+    if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
+        arg7i = Gua_ObjectToInteger(argv[7]);
+    } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
+        arg7i = roundl(Gua_ObjectToReal(argv[7]));            
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[8]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glCompressedTexSubImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i, arg9bv);
+        return GUA_ERROR;
+    }
+    
+    arg8bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glCompressedTexImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8bv);
+    
+    return GUA_OK;
+}
 #endif
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glCopyTexImage2D") == 0) {
-        if (argc != 9) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 7 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5i = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5i = roundl(Gua_ObjectToReal(argv[5]));            
-        }
-        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-            arg6i = Gua_ObjectToInteger(argv[6]);
-        } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
-            arg6i = roundl(Gua_ObjectToReal(argv[6]));            
-        }
-        if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
-            arg7i = Gua_ObjectToInteger(argv[7]);
-        } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
-            arg7i = roundl(Gua_ObjectToReal(argv[7]));            
-        }
-        if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
-            arg8i = Gua_ObjectToInteger(argv[8]);
-        } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
-            arg8i = roundl(Gua_ObjectToReal(argv[8]));            
-        }
+#ifndef _WINDOWS_
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlCompressedTexSubImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlCompressedTexSubImage2D function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlCompressedTexSubImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLint arg4i;
+    GLint arg5i;
+    GLint arg6i;
+    GLint arg7i;
+    GLint arg8i;
+    GLbyte *arg9bv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    arg5i = 0;
+    arg6i = 0;
+    arg7i = 0;
+    arg8i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5i = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5i = roundl(Gua_ObjectToReal(argv[5]));            
+    }
+    if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+        arg6i = Gua_ObjectToInteger(argv[6]);
+    } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
+        arg6i = roundl(Gua_ObjectToReal(argv[6]));            
+    }
+    if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
+        arg7i = Gua_ObjectToInteger(argv[7]);
+    } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
+        arg7i = roundl(Gua_ObjectToReal(argv[7]));            
+    }
+    if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
+        arg8i = Gua_ObjectToInteger(argv[8]);
+    } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
+        arg8i = roundl(Gua_ObjectToReal(argv[8]));            
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[9]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glCopyTexImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glCopyTexSubImage2D") == 0) {
-        if (argc != 9) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg9bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glCompressedTexSubImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i, arg9bv);
+    
+    return GUA_OK;
+}
+#endif
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 7 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5i = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5i = roundl(Gua_ObjectToReal(argv[5]));            
-        }
-        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-            arg6i = Gua_ObjectToInteger(argv[6]);
-        } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
-            arg6i = roundl(Gua_ObjectToReal(argv[6]));            
-        }
-        if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
-            arg7i = Gua_ObjectToInteger(argv[7]);
-        } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
-            arg7i = roundl(Gua_ObjectToReal(argv[7]));            
-        }
-        if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
-            arg8i = Gua_ObjectToInteger(argv[8]);
-        } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
-            arg8i = roundl(Gua_ObjectToReal(argv[8]));            
-        }
-        
-        glCopyTexSubImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glCullFace") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlCopyTexImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlCopyTexImage2D function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlCopyTexImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLint arg4i;
+    GLint arg5i;
+    GLint arg6i;
+    GLint arg7i;
+    GLint arg8i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    arg5i = 0;
+    arg6i = 0;
+    arg7i = 0;
+    arg8i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5i = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5i = roundl(Gua_ObjectToReal(argv[5]));            
+    }
+    if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+        arg6i = Gua_ObjectToInteger(argv[6]);
+    } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
+        arg6i = roundl(Gua_ObjectToReal(argv[6]));            
+    }
+    if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
+        arg7i = Gua_ObjectToInteger(argv[7]);
+    } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
+        arg7i = roundl(Gua_ObjectToReal(argv[7]));            
+    }
+    if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
+        arg8i = Gua_ObjectToInteger(argv[8]);
+    } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
+        arg8i = roundl(Gua_ObjectToReal(argv[8]));            
+    }
+    
+    glCopyTexImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glCullFace(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDeleteBuffers") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDeleteLists") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glDeleteLists(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDeleteTextures") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-	    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!(Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[2]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfInt") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg2iv = (GLuint *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glDeleteTextures(arg1i, arg2iv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDepthFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glDepthFunc(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDepthMask") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glDepthMask(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDepthRange") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        
-        glDepthRange(arg1f, arg2f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDisable") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glDisable(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDisableClientState") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glDisableClientState(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDrawArrays") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        
-        glDrawArrays(arg1i, arg2i, arg3i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glDrawElements") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-	    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!(Gua_ObjectType(argv[4]) == OBJECT_TYPE_HANDLE)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg4bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glDrawElements(arg1i, arg2i, arg3i, arg4bv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glEnable") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glEnable(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glEnableClientState") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glEnableClientState(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glEnd") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glEnd();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glEndList") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glEndList();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glFinish") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glFinish();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glFlush") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glFlush();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glFog") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-	    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE) {
-            h = (Gua_Handle *)Gua_ObjectToHandle(argv[2]);
-            
-            if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            
-            arg2fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-        }
-        
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            glFogf(arg1i, arg2f);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_MATRIX) {
-            glFogfv(arg1i, arg2fv);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glFree") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (!((strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") == 0) || (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfInt") == 0) || (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") == 0))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") == 0) {
-            arg1bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
-            
-            Gua_Free(arg1bv);
-        } else if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfInt") == 0) {
-            arg1iv = (GLuint *)Gua_GetHandlePointer((Gua_Handle *)h);
-            
-            Gua_Free(arg1iv);
-        } else if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") == 0) {
-            arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-            
-            Gua_Free(arg1fv);
-        }
-        
-        Gua_SetHandlePointer((Gua_Handle *)h, NULL);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glFrontFace") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glFrontFace(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glFrustum") == 0) {
-        if (argc != 7) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4f = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4f = Gua_ObjectToReal(argv[4]);            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5f = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5f = Gua_ObjectToReal(argv[5]);            
-        }
-        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-            arg6f = Gua_ObjectToInteger(argv[6]);
-        } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
-            arg6f = Gua_ObjectToReal(argv[6]);            
-        }
-        
-        glFrustum(arg1f, arg2f, arg3f, arg4f, arg5f, arg6f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGenBuffers") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGenLists") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        Gua_IntegerToPObject(object, glGenLists(arg1i));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGenTextures") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        if (arg1i == 0) {
-            return GUA_OK;
-        }
-        
-        l = arg1i;
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), l);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 1;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = l;
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(l * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        arg2iv = (GLuint *)malloc(sizeof(GLuint) * l);
-        
-        glGenTextures(arg1i, arg2iv);
-        
-        for (i = 0; i < l; i++) {
-            Gua_IntegerToObject(o[i], arg2iv[i]);
-        }
-        
-        Gua_Free(arg2iv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGet") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-#ifndef _WINDOWS_
-        if (arg1i == GL_ACTIVE_TEXTURE) {
-            l = 1;
-        } else if (arg1i == GL_ALIASED_POINT_SIZE_RANGE) {
-            l = 2;
-        } else if (arg1i == GL_ALIASED_LINE_WIDTH_RANGE) {
-            l = 2;
-        } else if (arg1i == GL_ALPHA_BITS) {
-#else
-        if (arg1i == GL_ALPHA_BITS) {
-#endif
-            l = 1;
-        } else if (arg1i == GL_ALPHA_TEST) {
-            l = 1;
-        } else if (arg1i == GL_ALPHA_TEST_FUNC) {
-            l = 1;
-        } else if (arg1i == GL_ALPHA_TEST_REF) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_ARRAY_BUFFER_BINDING) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_BLEND) {
-            l = 1;
-        } else if (arg1i == GL_BLEND_DST) {
-            l = 1;
-        } else if (arg1i == GL_BLEND_SRC) {
-            l = 1;
-        } else if (arg1i == GL_BLUE_BITS) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_CLIENT_ACTIVE_TEXTURE) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_CLIP_PLANE0) {
-            l = 1;
-        } else if (arg1i == GL_CLIP_PLANE1) {
-            l = 1;
-        } else if (arg1i == GL_CLIP_PLANE2) {
-            l = 1;
-        } else if (arg1i == GL_CLIP_PLANE3) {
-            l = 1;
-        } else if (arg1i == GL_CLIP_PLANE4) {
-            l = 1;
-        } else if (arg1i == GL_CLIP_PLANE5) {
-            l = 1;
-        } else if (arg1i == GL_COLOR_ARRAY) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_COLOR_ARRAY_BUFFER_BINDING) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_COLOR_ARRAY_SIZE) {
-            l = 1;
-        } else if (arg1i == GL_COLOR_ARRAY_STRIDE) {
-            l = 1;
-        } else if (arg1i == GL_COLOR_ARRAY_TYPE) {
-            l = 1;
-        } else if (arg1i == GL_COLOR_CLEAR_VALUE) {
-            l = 4;
-        } else if (arg1i == GL_COLOR_LOGIC_OP) {
-            l = 1;
-        } else if (arg1i == GL_COLOR_MATERIAL) {
-            l = 1;
-        } else if (arg1i == GL_COLOR_WRITEMASK) {
-            l = 4;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_COMPRESSED_TEXTURE_FORMATS) {
-            glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &arg2i);
-            l = arg2i;
-#endif
-        } else if (arg1i == GL_CULL_FACE) {
-            l = 1;
-        } else if (arg1i == GL_CULL_FACE_MODE) {
-            l = 1;
-        } else if (arg1i == GL_CURRENT_COLOR) {
-            l = 4;
-        } else if (arg1i == GL_CURRENT_NORMAL) {
-            l = 3;
-        } else if (arg1i == GL_CURRENT_TEXTURE_COORDS) {
-            l = 4;
-        } else if (arg1i == GL_DEPTH_BITS) {
-            l = 1;
-        } else if (arg1i == GL_DEPTH_CLEAR_VALUE) {
-            l = 1;
-        } else if (arg1i == GL_DEPTH_FUNC) {
-            l = 1;
-        } else if (arg1i == GL_DEPTH_RANGE) {
-            l = 2;
-        } else if (arg1i == GL_DEPTH_TEST) {
-            l = 1;
-        } else if (arg1i == GL_DEPTH_WRITEMASK) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_ELEMENT_ARRAY_BUFFER_BINDING) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_FOG) {
-            l = 1;
-        } else if (arg1i == GL_FOG_COLOR) {
-            l = 4;
-        } else if (arg1i == GL_FOG_DENSITY) {
-            l = 1;
-        } else if (arg1i == GL_FOG_END) {
-            l = 1;
-        } else if (arg1i == GL_FOG_HINT) {
-            l = 1;
-        } else if (arg1i == GL_FOG_MODE) {
-            l = 1;
-        } else if (arg1i == GL_FOG_START) {
-            l = 1;
-        } else if (arg1i == GL_FRONT_FACE) {
-            l = 1;
-        } else if (arg1i == GL_GREEN_BITS) {
-            l = 1;
-        } else if (arg1i == GL_LIGHT_MODEL_AMBIENT) {
-            l = 4;
-        } else if (arg1i == GL_LIGHT_MODEL_TWO_SIDE) {
-            l = 1;
-        } else if (arg1i == GL_LIGHT0) {
-            l = 1;
-        } else if (arg1i == GL_LIGHT1) {
-            l = 1;
-        } else if (arg1i == GL_LIGHT2) {
-            l = 1;
-        } else if (arg1i == GL_LIGHT3) {
-            l = 1;
-        } else if (arg1i == GL_LIGHT4) {
-            l = 1;
-        } else if (arg1i == GL_LIGHT5) {
-            l = 1;
-        } else if (arg1i == GL_LIGHT6) {
-            l = 1;
-        } else if (arg1i == GL_LIGHT7) {
-            l = 1;
-        } else if (arg1i == GL_LIGHTING) {
-            l = 1;
-        } else if (arg1i == GL_LINE_SMOOTH) {
-            l = 1;
-        } else if (arg1i == GL_LINE_SMOOTH_HINT) {
-            l = 1;
-        } else if (arg1i == GL_LINE_WIDTH) {
-            l = 1;
-        } else if (arg1i == GL_LOGIC_OP_MODE) {
-            l = 1;
-        } else if (arg1i == GL_MATRIX_MODE) {
-            l = 1;
-        } else if (arg1i == GL_MAX_CLIP_PLANES) {
-            l = 1;
-        } else if (arg1i == GL_MAX_LIGHTS) {
-            l = 1;
-        } else if (arg1i == GL_MAX_MODELVIEW_STACK_DEPTH) {
-            l = 1;
-        } else if (arg1i == GL_MAX_PROJECTION_STACK_DEPTH) {
-            l = 1;
-        } else if (arg1i == GL_MAX_TEXTURE_SIZE) {
-            l = 1;
-        } else if (arg1i == GL_MAX_TEXTURE_STACK_DEPTH) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_MAX_TEXTURE_UNITS) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_MAX_VIEWPORT_DIMS) {
-            l = 2;
-        } else if (arg1i == GL_MODELVIEW_MATRIX) {
-            l = 16;
-        } else if (arg1i == GL_MODELVIEW_STACK_DEPTH) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_MULTISAMPLE) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_NORMAL_ARRAY) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_NORMAL_ARRAY_BUFFER_BINDING) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_NORMAL_ARRAY_STRIDE) {
-            l = 1;
-        } else if (arg1i == GL_NORMAL_ARRAY_TYPE) {
-            l = 1;
-        } else if (arg1i == GL_NORMALIZE) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_NUM_COMPRESSED_TEXTURE_FORMATS) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_PACK_ALIGNMENT) {
-            l = 1;
-        } else if (arg1i == GL_PERSPECTIVE_CORRECTION_HINT) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_POINT_DISTANCE_ATTENUATION) {
-            l = 3;
-        } else if (arg1i == GL_POINT_FADE_THRESHOLD_SIZE) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_POINT_SIZE) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_POINT_SIZE_MAX) {
-            l = 1;
-        } else if (arg1i == GL_POINT_SIZE_MIN) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_POINT_SMOOTH) {
-            l = 1;
-        } else if (arg1i == GL_POINT_SMOOTH_HINT) {
-            l = 1;
-        } else if (arg1i == GL_POLYGON_OFFSET_FACTOR) {
-            l = 1;
-        } else if (arg1i == GL_POLYGON_OFFSET_FILL) {
-            l = 1;
-        } else if (arg1i == GL_POLYGON_OFFSET_UNITS) {
-            l = 1;
-        } else if (arg1i == GL_PROJECTION_MATRIX) {
-            l = 16;
-        } else if (arg1i == GL_PROJECTION_STACK_DEPTH) {
-            l = 1;
-        } else if (arg1i == GL_RED_BITS) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_RESCALE_NORMAL) {
-            l = 1;
-        } else if (arg1i == GL_SAMPLE_ALPHA_TO_COVERAGE) {
-            l = 1;
-        } else if (arg1i == GL_SAMPLE_ALPHA_TO_ONE) {
-            l = 1;
-        } else if (arg1i == GL_SAMPLE_BUFFERS) {
-            l = 1;
-        } else if (arg1i == GL_SAMPLE_COVERAGE) {
-            l = 1;
-        } else if (arg1i == GL_SAMPLE_COVERAGE_INVERT) {
-            l = 1;
-        } else if (arg1i == GL_SAMPLE_COVERAGE_VALUE) {
-            l = 1;
-        } else if (arg1i == GL_SAMPLES) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_SCISSOR_BOX) {
-            l = 4;
-        } else if (arg1i == GL_SCISSOR_TEST) {
-            l = 1;
-        } else if (arg1i == GL_SHADE_MODEL) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_SMOOTH_LINE_WIDTH_RANGE) {
-            l = 2;
-        } else if (arg1i == GL_SMOOTH_POINT_SIZE_RANGE) {
-            l = 2;
-#endif
-        } else if (arg1i == GL_STENCIL_BITS) {
-            l = 1;
-        } else if (arg1i == GL_STENCIL_CLEAR_VALUE) {
-            l = 1;
-        } else if (arg1i == GL_STENCIL_FAIL) {
-            l = 1;
-        } else if (arg1i == GL_STENCIL_FUNC) {
-            l = 1;
-        } else if (arg1i == GL_STENCIL_PASS_DEPTH_FAIL) {
-            l = 1;
-        } else if (arg1i == GL_STENCIL_PASS_DEPTH_PASS) {
-            l = 1;
-        } else if (arg1i == GL_STENCIL_REF) {
-            l = 1;
-        } else if (arg1i == GL_STENCIL_TEST) {
-            l = 1;
-        } else if (arg1i == GL_STENCIL_VALUE_MASK) {
-            l = 1;
-        } else if (arg1i == GL_STENCIL_WRITEMASK) {
-            l = 1;
-        } else if (arg1i == GL_SUBPIXEL_BITS) {
-            l = 1;
-        } else if (arg1i == GL_TEXTURE_2D) {
-            l = 1;
-        } else if (arg1i == GL_TEXTURE_BINDING_2D) {
-            l = 1;
-        } else if (arg1i == GL_TEXTURE_COORD_ARRAY) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_TEXTURE_COORD_ARRAY_BUFFER_BINDING) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_TEXTURE_COORD_ARRAY_SIZE) {
-            l = 1;
-        } else if (arg1i == GL_TEXTURE_COORD_ARRAY_STRIDE) {
-            l = 1;
-        } else if (arg1i == GL_TEXTURE_COORD_ARRAY_TYPE) {
-            l = 1;
-        } else if (arg1i == GL_TEXTURE_MATRIX) {
-            l = 16;
-        } else if (arg1i == GL_TEXTURE_STACK_DEPTH) {
-            l = 1;
-        } else if (arg1i == GL_UNPACK_ALIGNMENT) {
-            l = 1;
-        } else if (arg1i == GL_VIEWPORT) {
-            l = 4;
-        } else if (arg1i == GL_VERTEX_ARRAY) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg1i == GL_VERTEX_ARRAY_BUFFER_BINDING) {
-            l = 1;
-#endif
-        } else if (arg1i == GL_VERTEX_ARRAY_SIZE) {
-            l = 1;
-        } else if (arg1i == GL_VERTEX_ARRAY_STRIDE) {
-            l = 1;
-        } else if (arg1i == GL_VERTEX_ARRAY_TYPE) {
-            l = 1;
-        } else {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), l);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 1;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = l;
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(l * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        arg2fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
-        
-        glGetFloatv(arg1i, arg2fv);
-        
-        for (i = 0; i < l; i++) {
-            Gua_IntegerToObject(o[i], arg2fv[i]);
-        }
-        
-        Gua_Free(arg2fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGetBufferParameteriv") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGetClipPlane") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        l = 4;
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), l);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 1;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = l;
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(l * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        arg2dv = (GLdouble *)malloc(sizeof(GLdouble) * l);
-        
-        glGetClipPlane(arg1i, arg2dv);
-        
-        for (i = 0; i < l; i++) {
-            Gua_RealToObject(o[i], arg2dv[i]);
-        }
-        
-        Gua_Free(arg2dv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGetError") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, glGetError());
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGetLight") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        if (arg2i == GL_AMBIENT) {
-            l = 4;
-        } else if (arg2i == GL_DIFFUSE) {
-            l = 4;
-        } else if (arg2i == GL_SPECULAR) {
-            l = 4;
-        } else if (arg2i == GL_POSITION) {
-            l = 4;
-        } else if (arg2i == GL_SPOT_DIRECTION) {
-            l = 3;
-        } else if (arg2i == GL_SPOT_EXPONENT) {
-            l = 1;
-        } else if (arg2i == GL_SPOT_CUTOFF) {
-            l = 1;
-        } else if (arg2i == GL_CONSTANT_ATTENUATION) {
-            l = 1;
-        } else if (arg2i == GL_LINEAR_ATTENUATION) {
-            l = 1;
-        } else if (arg2i == GL_QUADRATIC_ATTENUATION) {
-            l = 1;
-        } else {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), l);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 1;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = l;
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(l * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        arg3fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
-        
-        glGetLightfv(arg1i, arg2i, arg3fv);
-        
-        for (i = 0; i < l; i++) {
-            Gua_IntegerToObject(o[i], arg3fv[i]);
-        }
-        
-        Gua_Free(arg3fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGetMaterial") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        if (arg2i == GL_AMBIENT) {
-            l = 4;
-        } else if (arg2i == GL_DIFFUSE) {
-            l = 4;
-        } else if (arg2i == GL_SPECULAR) {
-            l = 4;
-        } else if (arg2i == GL_EMISSION) {
-            l = 4;
-        } else if (arg2i == GL_SHININESS) {
-            l = 1;
-        } else {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), l);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 1;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = l;
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(l * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        arg3fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
-        
-        glGetMaterialfv(arg1i, arg2i, arg3fv);
-        
-        for (i = 0; i < l; i++) {
-            Gua_IntegerToObject(o[i], arg3fv[i]);
-        }
-        
-        Gua_Free(arg3fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGetPointerv") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGetString") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        resbv = glGetString(arg1i);
-        
-        Gua_StringToPObject(object, (const char *)resbv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGetTexEnv") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        if (arg2i == GL_TEXTURE_ENV_MODE) {
-            l = 1;
-        } else if (arg2i == GL_TEXTURE_ENV_COLOR) {
-            l = 4;
-#ifndef _WINDOWS_
-        } else if (arg2i == GL_COMBINE_RGB) {
-            l = 1;
-        } else if (arg2i == GL_COMBINE_ALPHA) {
-            l = 1;
-        } else if (arg2i == GL_SRC0_RGB) {
-            l = 1;
-        } else if (arg2i == GL_SRC1_RGB) {
-            l = 1;
-        } else if (arg2i == GL_SRC2_RGB) {
-            l = 1;
-        } else if (arg2i == GL_SRC0_ALPHA) {
-            l = 1;
-        } else if (arg2i == GL_SRC1_ALPHA) {
-            l = 1;
-        } else if (arg2i == GL_SRC2_ALPHA) {
-            l = 1;
-        } else if (arg2i == GL_OPERAND0_RGB) {
-            l = 1;
-        } else if (arg2i == GL_OPERAND1_RGB) {
-            l = 1;
-        } else if (arg2i == GL_OPERAND2_RGB) {
-            l = 1;
-        } else if (arg2i == GL_OPERAND0_ALPHA) {
-            l = 1;
-        } else if (arg2i == GL_OPERAND1_ALPHA) {
-            l = 1;
-        } else if (arg2i == GL_OPERAND2_ALPHA) {
-            l = 1;
-        } else if (arg2i == GL_RGB_SCALE) {
-            l = 1;
-#endif
-        } else if (arg2i == GL_ALPHA_SCALE) {
-            l = 1;
-        } else {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), l);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 1;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = l;
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(l * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        arg3fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
-        
-        glGetTexEnvfv(arg1i, arg2i, arg3fv);
-        
-        for (i = 0; i < l; i++) {
-            Gua_IntegerToObject(o[i], arg3fv[i]);
-        }
-        
-        Gua_Free(arg3fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glGetTexParameter") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        if (arg2i == GL_TEXTURE_MIN_FILTER) {
-            l = 1;
-        } else if (arg2i == GL_TEXTURE_MAG_FILTER) {
-            l = 1;
-        } else if (arg2i == GL_TEXTURE_WRAP_S) {
-            l = 1;
-        } else if (arg2i == GL_TEXTURE_WRAP_T) {
-            l = 1;
-#ifndef _WINDOWS_
-        } else if (arg2i == GL_GENERATE_MIPMAP) {
-            l = 1;
-#endif
-        } else {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), l);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 1;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = l;
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(l * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        arg3fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
-        
-        glGetTexParameterfv(arg1i, arg2i, arg3fv);
-        
-        for (i = 0; i < l; i++) {
-            Gua_IntegerToObject(o[i], arg3fv[i]);
-        }
-        
-        Gua_Free(arg3fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glHint") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));           
-        }
-        
-        glHint(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glIsBuffer") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glIsEnabled") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        Gua_IntegerToPObject(object, glIsEnabled(arg1i));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glIsList") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        Gua_IntegerToPObject(object, glIsList(arg1i));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glIsTexture") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        Gua_IntegerToPObject(object, glIsTexture(arg1i));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glLight") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE) {
-            h = (Gua_Handle *)Gua_ObjectToHandle(argv[3]);
-            
-            if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            
-            arg3fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-        }
-        
-        if ((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL)) {
-            glLightf(arg1i, arg2i, arg3f);
-        } else {
-            glLightfv(arg1i, arg2i, arg3fv);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glLightModel") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE) {
-            h = (Gua_Handle *)Gua_ObjectToHandle(argv[2]);
-            
-            if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            
-            arg2fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-        }
-        
-        if ((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            glLightModelf(arg1i, arg2f);
-        } else {
-            glLightModelfv(arg1i, arg2fv);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glLineWidth") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        
-        glLineWidth(arg1f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glListBase") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        
-        glListBase(arg1d);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glLoadIdentity") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glLoadIdentity();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glLoadMatrix") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glLoadMatrixf(arg1fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glLogicOp") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glLogicOp(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glMaterial") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE) {
-            h = (Gua_Handle *)Gua_ObjectToHandle(argv[3]);
-            
-            if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            
-            arg3fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-        }
-        
-        if ((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL)) {
-            glMaterialf(arg1i, arg2i, arg3f);
-        } else {
-            glMaterialfv(arg1i, arg2i, arg3fv);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glMatrixMode") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glMatrixMode(arg1i);
-#ifndef _WINDOWS_
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glMultiTexCoord") == 0) {
-        if (argc != 6) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4f = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4f = Gua_ObjectToReal(argv[4]);            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5f = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5f = Gua_ObjectToReal(argv[5]);            
-        }
-        
-        glMultiTexCoord4f(arg1i, arg2f, arg3f, arg4f, arg5f);
-#endif
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glMultMatrix") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glMultMatrixf(arg1fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glNewList") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glNewList(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glNormal") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        
-        glNormal3f(arg1f, arg2f, arg3f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glNormalPointer") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlCopyTexSubImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlCopyTexSubImage2D function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlCopyTexSubImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLint arg4i;
+    GLint arg5i;
+    GLint arg6i;
+    GLint arg7i;
+    GLint arg8i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    arg5i = 0;
+    arg6i = 0;
+    arg7i = 0;
+    arg8i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5i = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5i = roundl(Gua_ObjectToReal(argv[5]));            
+    }
+    if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+        arg6i = Gua_ObjectToInteger(argv[6]);
+    } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
+        arg6i = roundl(Gua_ObjectToReal(argv[6]));            
+    }
+    if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
+        arg7i = Gua_ObjectToInteger(argv[7]);
+    } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
+        arg7i = roundl(Gua_ObjectToReal(argv[7]));            
+    }
+    if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
+        arg8i = Gua_ObjectToInteger(argv[8]);
+    } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
+        arg8i = roundl(Gua_ObjectToReal(argv[8]));            
+    }
+    
+    glCopyTexSubImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i);
+    
+    return GUA_OK;
+}
 
-	    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!(Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        /*
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        */
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[3]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg3fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glNormalPointer(GL_FLOAT, arg2i, arg3fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glOrtho") == 0) {
-        if (argc != 7) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4f = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4f = Gua_ObjectToReal(argv[4]);            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5f = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5f = Gua_ObjectToReal(argv[5]);            
-        }
-        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-            arg6f = Gua_ObjectToInteger(argv[6]);
-        } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
-            arg6f = Gua_ObjectToReal(argv[6]);            
-        }
-        
-        glOrtho(arg1f, arg2f, arg3f, arg4f, arg5f, arg6f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glPixelStore") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlCullFaceFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlCullFace function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlCullFaceFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glCullFace(arg1i);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDeleteBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDeleteBuffers function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDeleteBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDeleteListsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDeleteLists function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDeleteListsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    glDeleteLists(arg1i, arg2i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDeleteTexturesFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDeleteTextures function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDeleteTexturesFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLuint *arg2iv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (!(Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[2]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfInt") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glPixelStorei(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glPointParameter") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glPointSize") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg2iv = (GLuint *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glDeleteTextures(arg1i, arg2iv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDepthFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDepthFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDepthFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glDepthFunc(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDepthMaskFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDepthMask function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDepthMaskFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glDepthMask(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDepthRangeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDepthRange function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDepthRangeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    }
+    
+    glDepthRange(arg1f, arg2f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDisableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDisable function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDisableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glDisable(arg1i);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        
-        glPointSize(arg1f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glPolygonOffset") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDisableClientStateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDisableClientState function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDisableClientStateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glDisableClientState(arg1i);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        
-        glPolygonOffset(arg1f, arg2f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glPopMatrix") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glPopMatrix();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glPushMatrix") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glPushMatrix();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glRasterPos") == 0) {
-        if (!((argc >= 2) && (argc <= 5))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (argc >= 2) {
-		    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-                arg1f = Gua_ObjectToInteger(argv[1]);
-            } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-                arg1f = Gua_ObjectToReal(argv[1]);            
-            } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE) {
-                h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-                
-                if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-                    errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                    sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-                    strcat(error, errMessage);
-                    Gua_Free(errMessage);
-                    
-                    return GUA_ERROR;
-                }
-                
-                arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-            }
-        }
-        if (argc >= 3) {
-		    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-                arg2f = Gua_ObjectToInteger(argv[2]);
-            } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-                arg2f = Gua_ObjectToReal(argv[2]);            
-            }
-        }
-        if (argc >= 4) {
-		    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-                arg3f = Gua_ObjectToInteger(argv[3]);
-            } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-                arg3f = Gua_ObjectToReal(argv[3]);            
-            }
-        }
-        if (argc == 5) {
-            if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-                arg4f = Gua_ObjectToInteger(argv[4]);
-            } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-                arg4f = Gua_ObjectToReal(argv[4]);            
-            }
-        }
-        if (argc == 2) {
-            if (Gua_ObjectLength(argv[1]) == 2) {
-                glRasterPos2fv(arg1fv);
-            } else if (Gua_ObjectLength(argv[1]) == 3) {
-                glRasterPos3fv(arg1fv);
-            } else if (Gua_ObjectLength(argv[1]) == 4) {
-                glRasterPos4fv(arg1fv);
-            }
-        } else if (argc == 3) {
-            glRasterPos2f(arg1f, arg2f);
-        } else if (argc == 4) {
-            glRasterPos3f(arg1f, arg2f, arg3f);
-        } else if (argc == 5) {
-            glRasterPos4f(arg1f, arg2f, arg3f, arg4f);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glReadPixels") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glRotate") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDrawArraysFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDrawArrays function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDrawArraysFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    
+    glDrawArrays(arg1i, arg2i, arg3i);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlDrawElementsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlDrawElements function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlDrawElementsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLbyte *arg4bv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    
+    if (!(Gua_ObjectType(argv[4]) == OBJECT_TYPE_HANDLE)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4f = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4f = Gua_ObjectToReal(argv[4]);            
-        }
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glRotatef(arg1f, arg2f, arg3f, arg4f);
-#ifndef _WINDOWS_
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glSampleCoverage") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg4bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glDrawElements(arg1i, arg2i, arg3i, arg4bv);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlEnableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlEnable function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlEnableFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glEnable(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlEnableClientStateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlEnableClientState function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlEnableClientStateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glEnableClientState(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlEndFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlEnd function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlEndFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glEnd();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlEndListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlEndList function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlEndListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glEndList();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlFinishFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlFinish function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlFinishFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glFinish();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlFlushFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlFlush function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlFlushFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glFlush();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlFogFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlFog function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlFogFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLdouble arg2f;
+    GLfloat *arg2fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    arg2f = 0.0;
+    
+    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE) {
+        h = (Gua_Handle *)Gua_ObjectToHandle(argv[2]);
         
-        glSampleCoverage(arg1f, arg2i);
-#endif
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glScale") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
+        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -4106,713 +2258,1598 @@ Gua_Status Gl_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
             
             return GUA_ERROR;
         }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
         
-        glScalef(arg1f, arg2f, arg3f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glScissor") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        arg2fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    }
+    
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        glFogf(arg1i, arg2f);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_MATRIX) {
+        glFogfv(arg1i, arg2fv);
+    }
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlFreeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlFree function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlFreeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLbyte *arg1bv;
+    GLuint *arg1iv;
+    GLfloat *arg1fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (!((strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") == 0) || (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfInt") == 0) || (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") == 0))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
+        return GUA_ERROR;
+    }
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") == 0) {
+        arg1bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
         
-        glScissor(arg1i, arg2i, arg3i, arg4i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glShadeModel") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        Gua_Free(arg1bv);
+    } else if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfInt") == 0) {
+        arg1iv = (GLuint *)Gua_GetHandlePointer((Gua_Handle *)h);
         
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
+        Gua_Free(arg1iv);
+    } else if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") == 0) {
+        arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
         
-        glShadeModel(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glStencilFunc") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        Gua_Free(arg1fv);
+    }
+    
+    Gua_SetHandlePointer((Gua_Handle *)h, NULL);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlFrontFaceFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlFrontFace function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlFrontFaceFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glFrontFace(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlFrustumFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlFrustum function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlFrustumFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    GLdouble arg4f;
+    GLdouble arg5f;
+    GLdouble arg6f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    arg4f = 0.0;
+    arg5f = 0.0;
+    arg6f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4f = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4f = Gua_ObjectToReal(argv[4]);            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5f = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5f = Gua_ObjectToReal(argv[5]);            
+    }
+    if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+        arg6f = Gua_ObjectToInteger(argv[6]);
+    } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
+        arg6f = Gua_ObjectToReal(argv[6]);            
+    }
+    
+    glFrustum(arg1f, arg2f, arg3f, arg4f, arg5f, arg6f);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        
-        glStencilFunc(arg1i, arg2i, arg3i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glStencilMask") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGenBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGenBuffers function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGenBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glStencilMask(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glStencilOp") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGenListsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGenLists function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGenListsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    Gua_IntegerToPObject(object, glGenLists(arg1i));
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGenTexturesFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGenTextures function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGenTexturesFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLuint *arg2iv;
+    Gua_Length i;
+    Gua_Length l;
+    Gua_Matrix *m;
+    Gua_Object *o;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    i = 0;
+    l = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    if (arg1i == 0) {
+        return GUA_OK;
+    }
+    
+    l = arg1i;
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), l);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 1;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = l;
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(l * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    arg2iv = (GLuint *)malloc(sizeof(GLuint) * l);
+    
+    glGenTextures(arg1i, arg2iv);
+    
+    for (i = 0; i < l; i++) {
+        Gua_IntegerToObject(o[i], arg2iv[i]);
+    }
+    
+    Gua_Free(arg2iv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGet function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLfloat *arg2fv;
+    Gua_Length i;
+    Gua_Length l;
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    i = 0;
+    l = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+#ifndef _WINDOWS_
+    if (arg1i == GL_ACTIVE_TEXTURE) {
+        l = 1;
+    } else if (arg1i == GL_ALIASED_POINT_SIZE_RANGE) {
+        l = 2;
+    } else if (arg1i == GL_ALIASED_LINE_WIDTH_RANGE) {
+        l = 2;
+    } else if (arg1i == GL_ALPHA_BITS) {
+#else
+    if (arg1i == GL_ALPHA_BITS) {
+#endif
+        l = 1;
+    } else if (arg1i == GL_ALPHA_TEST) {
+        l = 1;
+    } else if (arg1i == GL_ALPHA_TEST_FUNC) {
+        l = 1;
+    } else if (arg1i == GL_ALPHA_TEST_REF) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_ARRAY_BUFFER_BINDING) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_BLEND) {
+        l = 1;
+    } else if (arg1i == GL_BLEND_DST) {
+        l = 1;
+    } else if (arg1i == GL_BLEND_SRC) {
+        l = 1;
+    } else if (arg1i == GL_BLUE_BITS) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_CLIENT_ACTIVE_TEXTURE) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_CLIP_PLANE0) {
+        l = 1;
+    } else if (arg1i == GL_CLIP_PLANE1) {
+        l = 1;
+    } else if (arg1i == GL_CLIP_PLANE2) {
+        l = 1;
+    } else if (arg1i == GL_CLIP_PLANE3) {
+        l = 1;
+    } else if (arg1i == GL_CLIP_PLANE4) {
+        l = 1;
+    } else if (arg1i == GL_CLIP_PLANE5) {
+        l = 1;
+    } else if (arg1i == GL_COLOR_ARRAY) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_COLOR_ARRAY_BUFFER_BINDING) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_COLOR_ARRAY_SIZE) {
+        l = 1;
+    } else if (arg1i == GL_COLOR_ARRAY_STRIDE) {
+        l = 1;
+    } else if (arg1i == GL_COLOR_ARRAY_TYPE) {
+        l = 1;
+    } else if (arg1i == GL_COLOR_CLEAR_VALUE) {
+        l = 4;
+    } else if (arg1i == GL_COLOR_LOGIC_OP) {
+        l = 1;
+    } else if (arg1i == GL_COLOR_MATERIAL) {
+        l = 1;
+    } else if (arg1i == GL_COLOR_WRITEMASK) {
+        l = 4;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_COMPRESSED_TEXTURE_FORMATS) {
+        glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &arg2i);
+        l = arg2i;
+#endif
+    } else if (arg1i == GL_CULL_FACE) {
+        l = 1;
+    } else if (arg1i == GL_CULL_FACE_MODE) {
+        l = 1;
+    } else if (arg1i == GL_CURRENT_COLOR) {
+        l = 4;
+    } else if (arg1i == GL_CURRENT_NORMAL) {
+        l = 3;
+    } else if (arg1i == GL_CURRENT_TEXTURE_COORDS) {
+        l = 4;
+    } else if (arg1i == GL_DEPTH_BITS) {
+        l = 1;
+    } else if (arg1i == GL_DEPTH_CLEAR_VALUE) {
+        l = 1;
+    } else if (arg1i == GL_DEPTH_FUNC) {
+        l = 1;
+    } else if (arg1i == GL_DEPTH_RANGE) {
+        l = 2;
+    } else if (arg1i == GL_DEPTH_TEST) {
+        l = 1;
+    } else if (arg1i == GL_DEPTH_WRITEMASK) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_ELEMENT_ARRAY_BUFFER_BINDING) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_FOG) {
+        l = 1;
+    } else if (arg1i == GL_FOG_COLOR) {
+        l = 4;
+    } else if (arg1i == GL_FOG_DENSITY) {
+        l = 1;
+    } else if (arg1i == GL_FOG_END) {
+        l = 1;
+    } else if (arg1i == GL_FOG_HINT) {
+        l = 1;
+    } else if (arg1i == GL_FOG_MODE) {
+        l = 1;
+    } else if (arg1i == GL_FOG_START) {
+        l = 1;
+    } else if (arg1i == GL_FRONT_FACE) {
+        l = 1;
+    } else if (arg1i == GL_GREEN_BITS) {
+        l = 1;
+    } else if (arg1i == GL_LIGHT_MODEL_AMBIENT) {
+        l = 4;
+    } else if (arg1i == GL_LIGHT_MODEL_TWO_SIDE) {
+        l = 1;
+    } else if (arg1i == GL_LIGHT0) {
+        l = 1;
+    } else if (arg1i == GL_LIGHT1) {
+        l = 1;
+    } else if (arg1i == GL_LIGHT2) {
+        l = 1;
+    } else if (arg1i == GL_LIGHT3) {
+        l = 1;
+    } else if (arg1i == GL_LIGHT4) {
+        l = 1;
+    } else if (arg1i == GL_LIGHT5) {
+        l = 1;
+    } else if (arg1i == GL_LIGHT6) {
+        l = 1;
+    } else if (arg1i == GL_LIGHT7) {
+        l = 1;
+    } else if (arg1i == GL_LIGHTING) {
+        l = 1;
+    } else if (arg1i == GL_LINE_SMOOTH) {
+        l = 1;
+    } else if (arg1i == GL_LINE_SMOOTH_HINT) {
+        l = 1;
+    } else if (arg1i == GL_LINE_WIDTH) {
+        l = 1;
+    } else if (arg1i == GL_LOGIC_OP_MODE) {
+        l = 1;
+    } else if (arg1i == GL_MATRIX_MODE) {
+        l = 1;
+    } else if (arg1i == GL_MAX_CLIP_PLANES) {
+        l = 1;
+    } else if (arg1i == GL_MAX_LIGHTS) {
+        l = 1;
+    } else if (arg1i == GL_MAX_MODELVIEW_STACK_DEPTH) {
+        l = 1;
+    } else if (arg1i == GL_MAX_PROJECTION_STACK_DEPTH) {
+        l = 1;
+    } else if (arg1i == GL_MAX_TEXTURE_SIZE) {
+        l = 1;
+    } else if (arg1i == GL_MAX_TEXTURE_STACK_DEPTH) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_MAX_TEXTURE_UNITS) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_MAX_VIEWPORT_DIMS) {
+        l = 2;
+    } else if (arg1i == GL_MODELVIEW_MATRIX) {
+        l = 16;
+    } else if (arg1i == GL_MODELVIEW_STACK_DEPTH) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_MULTISAMPLE) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_NORMAL_ARRAY) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_NORMAL_ARRAY_BUFFER_BINDING) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_NORMAL_ARRAY_STRIDE) {
+        l = 1;
+    } else if (arg1i == GL_NORMAL_ARRAY_TYPE) {
+        l = 1;
+    } else if (arg1i == GL_NORMALIZE) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_NUM_COMPRESSED_TEXTURE_FORMATS) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_PACK_ALIGNMENT) {
+        l = 1;
+    } else if (arg1i == GL_PERSPECTIVE_CORRECTION_HINT) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_POINT_DISTANCE_ATTENUATION) {
+        l = 3;
+    } else if (arg1i == GL_POINT_FADE_THRESHOLD_SIZE) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_POINT_SIZE) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_POINT_SIZE_MAX) {
+        l = 1;
+    } else if (arg1i == GL_POINT_SIZE_MIN) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_POINT_SMOOTH) {
+        l = 1;
+    } else if (arg1i == GL_POINT_SMOOTH_HINT) {
+        l = 1;
+    } else if (arg1i == GL_POLYGON_OFFSET_FACTOR) {
+        l = 1;
+    } else if (arg1i == GL_POLYGON_OFFSET_FILL) {
+        l = 1;
+    } else if (arg1i == GL_POLYGON_OFFSET_UNITS) {
+        l = 1;
+    } else if (arg1i == GL_PROJECTION_MATRIX) {
+        l = 16;
+    } else if (arg1i == GL_PROJECTION_STACK_DEPTH) {
+        l = 1;
+    } else if (arg1i == GL_RED_BITS) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_RESCALE_NORMAL) {
+        l = 1;
+    } else if (arg1i == GL_SAMPLE_ALPHA_TO_COVERAGE) {
+        l = 1;
+    } else if (arg1i == GL_SAMPLE_ALPHA_TO_ONE) {
+        l = 1;
+    } else if (arg1i == GL_SAMPLE_BUFFERS) {
+        l = 1;
+    } else if (arg1i == GL_SAMPLE_COVERAGE) {
+        l = 1;
+    } else if (arg1i == GL_SAMPLE_COVERAGE_INVERT) {
+        l = 1;
+    } else if (arg1i == GL_SAMPLE_COVERAGE_VALUE) {
+        l = 1;
+    } else if (arg1i == GL_SAMPLES) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_SCISSOR_BOX) {
+        l = 4;
+    } else if (arg1i == GL_SCISSOR_TEST) {
+        l = 1;
+    } else if (arg1i == GL_SHADE_MODEL) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_SMOOTH_LINE_WIDTH_RANGE) {
+        l = 2;
+    } else if (arg1i == GL_SMOOTH_POINT_SIZE_RANGE) {
+        l = 2;
+#endif
+    } else if (arg1i == GL_STENCIL_BITS) {
+        l = 1;
+    } else if (arg1i == GL_STENCIL_CLEAR_VALUE) {
+        l = 1;
+    } else if (arg1i == GL_STENCIL_FAIL) {
+        l = 1;
+    } else if (arg1i == GL_STENCIL_FUNC) {
+        l = 1;
+    } else if (arg1i == GL_STENCIL_PASS_DEPTH_FAIL) {
+        l = 1;
+    } else if (arg1i == GL_STENCIL_PASS_DEPTH_PASS) {
+        l = 1;
+    } else if (arg1i == GL_STENCIL_REF) {
+        l = 1;
+    } else if (arg1i == GL_STENCIL_TEST) {
+        l = 1;
+    } else if (arg1i == GL_STENCIL_VALUE_MASK) {
+        l = 1;
+    } else if (arg1i == GL_STENCIL_WRITEMASK) {
+        l = 1;
+    } else if (arg1i == GL_SUBPIXEL_BITS) {
+        l = 1;
+    } else if (arg1i == GL_TEXTURE_2D) {
+        l = 1;
+    } else if (arg1i == GL_TEXTURE_BINDING_2D) {
+        l = 1;
+    } else if (arg1i == GL_TEXTURE_COORD_ARRAY) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_TEXTURE_COORD_ARRAY_BUFFER_BINDING) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_TEXTURE_COORD_ARRAY_SIZE) {
+        l = 1;
+    } else if (arg1i == GL_TEXTURE_COORD_ARRAY_STRIDE) {
+        l = 1;
+    } else if (arg1i == GL_TEXTURE_COORD_ARRAY_TYPE) {
+        l = 1;
+    } else if (arg1i == GL_TEXTURE_MATRIX) {
+        l = 16;
+    } else if (arg1i == GL_TEXTURE_STACK_DEPTH) {
+        l = 1;
+    } else if (arg1i == GL_UNPACK_ALIGNMENT) {
+        l = 1;
+    } else if (arg1i == GL_VIEWPORT) {
+        l = 4;
+    } else if (arg1i == GL_VERTEX_ARRAY) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg1i == GL_VERTEX_ARRAY_BUFFER_BINDING) {
+        l = 1;
+#endif
+    } else if (arg1i == GL_VERTEX_ARRAY_SIZE) {
+        l = 1;
+    } else if (arg1i == GL_VERTEX_ARRAY_STRIDE) {
+        l = 1;
+    } else if (arg1i == GL_VERTEX_ARRAY_TYPE) {
+        l = 1;
+    } else {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glStencilOp(arg1i, arg2i, arg3i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glTexCoord") == 0) {
-        if (!((argc >= 2) && (argc <= 5))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), l);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 1;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = l;
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(l * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    arg2fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
+    
+    glGetFloatv(arg1i, arg2fv);
+    
+    for (i = 0; i < l; i++) {
+        Gua_IntegerToObject(o[i], arg2fv[i]);
+    }
+    
+    Gua_Free(arg2fv);
+    
+    return GUA_OK;
+}
 
-        if (argc >= 2) {
-		    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-                arg1f = Gua_ObjectToInteger(argv[1]);
-            } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-                arg1f = Gua_ObjectToReal(argv[1]);            
-            } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_MATRIX) {
-                h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-                
-                if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-                    errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                    sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-                    strcat(error, errMessage);
-                    Gua_Free(errMessage);
-                    
-                    return GUA_ERROR;
-                }
-                
-                arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-            }
-        }
-        if (argc >= 3) {
-		    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-                arg2f = Gua_ObjectToInteger(argv[2]);
-            } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-                arg2f = Gua_ObjectToReal(argv[2]);            
-            }
-        }
-        if (argc >= 4) {
-		    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-                arg3f = Gua_ObjectToInteger(argv[3]);
-            } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-                arg3f = Gua_ObjectToReal(argv[3]);            
-            }
-        }
-        if (argc == 5) {
-            if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-                arg4f = Gua_ObjectToInteger(argv[4]);
-            } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-                arg4f = Gua_ObjectToReal(argv[4]);            
-            }
-        }
-        if (argc == 2) {
-            if (Gua_ObjectLength(argv[1]) == 2) {
-                glTexCoord2fv(arg1fv);
-            } else if (Gua_ObjectLength(argv[1]) == 3) {
-                glTexCoord3fv(arg1fv);
-            } else if (Gua_ObjectLength(argv[1]) == 4) {
-                glTexCoord4fv(arg1fv);
-            }
-        } else if (argc == 3) {
-            glTexCoord2f(arg1f, arg2f);
-        } else if (argc == 4) {
-            glTexCoord3f(arg1f, arg2f, arg3f);
-        } else if (argc == 5) {
-            glTexCoord4f(arg1f, arg2f, arg3f, arg4f);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glTexCoordPointer") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetBufferParameterivFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGetBufferParameteriv function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetBufferParameterivFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
 
-	    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!(Gua_ObjectType(argv[4]) == OBJECT_TYPE_HANDLE)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        /*
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        */
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetClipPlaneFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGetClipPlane function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetClipPlaneFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLdouble *arg2dv;
+    Gua_Length i;
+    Gua_Length l;
+    Gua_Matrix *m;
+    Gua_Object *o;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    i = 0;
+    l = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    l = 4;
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), l);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 1;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = l;
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(l * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    arg2dv = (GLdouble *)malloc(sizeof(GLdouble) * l);
+    
+    glGetClipPlane(arg1i, arg2dv);
+    
+    for (i = 0; i < l; i++) {
+        Gua_RealToObject(o[i], arg2dv[i]);
+    }
+    
+    Gua_Free(arg2dv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetErrorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGetError function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetErrorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    Gua_IntegerToPObject(object, glGetError());
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetLightFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGetLight function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetLightFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLfloat *arg3fv;
+    Gua_Length i;
+    Gua_Length l;
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    i = 0;
+    l = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    if (arg2i == GL_AMBIENT) {
+        l = 4;
+    } else if (arg2i == GL_DIFFUSE) {
+        l = 4;
+    } else if (arg2i == GL_SPECULAR) {
+        l = 4;
+    } else if (arg2i == GL_POSITION) {
+        l = 4;
+    } else if (arg2i == GL_SPOT_DIRECTION) {
+        l = 3;
+    } else if (arg2i == GL_SPOT_EXPONENT) {
+        l = 1;
+    } else if (arg2i == GL_SPOT_CUTOFF) {
+        l = 1;
+    } else if (arg2i == GL_CONSTANT_ATTENUATION) {
+        l = 1;
+    } else if (arg2i == GL_LINEAR_ATTENUATION) {
+        l = 1;
+    } else if (arg2i == GL_QUADRATIC_ATTENUATION) {
+        l = 1;
+    } else {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
+        return GUA_ERROR;
+    }
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), l);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 1;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = l;
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(l * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    arg3fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
+    
+    glGetLightfv(arg1i, arg2i, arg3fv);
+    
+    for (i = 0; i < l; i++) {
+        Gua_IntegerToObject(o[i], arg3fv[i]);
+    }
+    
+    Gua_Free(arg3fv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetMaterialFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGetMaterial function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetMaterialFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLfloat *arg3fv;
+    Gua_Length i;
+    Gua_Length l;
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    i = 0;
+    l = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    if (arg2i == GL_AMBIENT) {
+        l = 4;
+    } else if (arg2i == GL_DIFFUSE) {
+        l = 4;
+    } else if (arg2i == GL_SPECULAR) {
+        l = 4;
+    } else if (arg2i == GL_EMISSION) {
+        l = 4;
+    } else if (arg2i == GL_SHININESS) {
+        l = 1;
+    } else {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), l);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 1;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = l;
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(l * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    arg3fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
+    
+    glGetMaterialfv(arg1i, arg2i, arg3fv);
+    
+    for (i = 0; i < l; i++) {
+        Gua_IntegerToObject(o[i], arg3fv[i]);
+    }
+    
+    Gua_Free(arg3fv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetPointervFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGetPointerv function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetPointervFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGetString function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    const GLubyte *resbv;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    resbv = glGetString(arg1i);
+    
+    Gua_StringToPObject(object, (const char *)resbv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetTexEnvFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGetTexEnv function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetTexEnvFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLfloat *arg3fv;
+    Gua_Length i;
+    Gua_Length l;
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    i = 0;
+    l = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    if (arg2i == GL_TEXTURE_ENV_MODE) {
+        l = 1;
+    } else if (arg2i == GL_TEXTURE_ENV_COLOR) {
+        l = 4;
+#ifndef _WINDOWS_
+    } else if (arg2i == GL_COMBINE_RGB) {
+        l = 1;
+    } else if (arg2i == GL_COMBINE_ALPHA) {
+        l = 1;
+    } else if (arg2i == GL_SRC0_RGB) {
+        l = 1;
+    } else if (arg2i == GL_SRC1_RGB) {
+        l = 1;
+    } else if (arg2i == GL_SRC2_RGB) {
+        l = 1;
+    } else if (arg2i == GL_SRC0_ALPHA) {
+        l = 1;
+    } else if (arg2i == GL_SRC1_ALPHA) {
+        l = 1;
+    } else if (arg2i == GL_SRC2_ALPHA) {
+        l = 1;
+    } else if (arg2i == GL_OPERAND0_RGB) {
+        l = 1;
+    } else if (arg2i == GL_OPERAND1_RGB) {
+        l = 1;
+    } else if (arg2i == GL_OPERAND2_RGB) {
+        l = 1;
+    } else if (arg2i == GL_OPERAND0_ALPHA) {
+        l = 1;
+    } else if (arg2i == GL_OPERAND1_ALPHA) {
+        l = 1;
+    } else if (arg2i == GL_OPERAND2_ALPHA) {
+        l = 1;
+    } else if (arg2i == GL_RGB_SCALE) {
+        l = 1;
+#endif
+    } else if (arg2i == GL_ALPHA_SCALE) {
+        l = 1;
+    } else {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg4fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), l);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 1;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = l;
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(l * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    arg3fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
+    
+    glGetTexEnvfv(arg1i, arg2i, arg3fv);
+    
+    for (i = 0; i < l; i++) {
+        Gua_IntegerToObject(o[i], arg3fv[i]);
+    }
+    
+    Gua_Free(arg3fv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlGetTexParameterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlGetTexParameter function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlGetTexParameterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLfloat *arg3fv;
+    Gua_Length i;
+    Gua_Length l;
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    i = 0;
+    l = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    if (arg2i == GL_TEXTURE_MIN_FILTER) {
+        l = 1;
+    } else if (arg2i == GL_TEXTURE_MAG_FILTER) {
+        l = 1;
+    } else if (arg2i == GL_TEXTURE_WRAP_S) {
+        l = 1;
+    } else if (arg2i == GL_TEXTURE_WRAP_T) {
+        l = 1;
+#ifndef _WINDOWS_
+    } else if (arg2i == GL_GENERATE_MIPMAP) {
+        l = 1;
+#endif
+    } else {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glTexCoordPointer(arg1i, GL_FLOAT, arg3i, arg4fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glTexEnv") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), l);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 1;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = l;
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(l * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    arg3fv = (GLfloat *)malloc(sizeof(GLfloat) * l);
+    
+    glGetTexParameterfv(arg1i, arg2i, arg3fv);
+    
+    for (i = 0; i < l; i++) {
+        Gua_IntegerToObject(o[i], arg3fv[i]);
+    }
+    
+    Gua_Free(arg3fv);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        
-        glTexEnvf(arg1i, arg2i, arg3f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glTexGen") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlHintFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlHint function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlHintFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));           
+    }
+    
+    glHint(arg1i, arg2i);
+    
+    return GUA_OK;
+}
 
-	    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE) {
-            h = (Gua_Handle *)Gua_ObjectToHandle(argv[3]);
-            
-            if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            
-            arg3fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-        }
-        
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            glTexGenf(arg1i, arg2i, arg3f);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE) {
-            glTexGenfv(arg1i, arg2i, arg3fv);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glTexImage2D") == 0) {
-        if (argc != 10) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlIsBufferFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlIsBuffer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlIsBufferFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlIsEnabledFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlIsEnabled function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlIsEnabledFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    Gua_IntegerToPObject(object, glIsEnabled(arg1i));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlIsListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlIsList function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlIsListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    Gua_IntegerToPObject(object, glIsList(arg1i));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlIsTextureFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlIsTexture function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlIsTextureFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    Gua_IntegerToPObject(object, glIsTexture(arg1i));
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 7 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[9]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5i = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5i = roundl(Gua_ObjectToReal(argv[5]));            
-        }
-        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-            arg6i = Gua_ObjectToInteger(argv[6]);
-        } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
-            arg6i = roundl(Gua_ObjectToReal(argv[6]));            
-        }
-        if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
-            arg7i = Gua_ObjectToInteger(argv[7]);
-        } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
-            arg7i = roundl(Gua_ObjectToReal(argv[7]));            
-        }
-        if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
-            arg8i = Gua_ObjectToInteger(argv[8]);
-        } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
-            arg8i = roundl(Gua_ObjectToReal(argv[8]));            
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[9]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlLightFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlLight function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlLightFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLdouble arg3f;
+    GLfloat *arg3fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    arg3f = 0.0;
+    
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg9bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE) {
+        h = (Gua_Handle *)Gua_ObjectToHandle(argv[3]);
         
-        glTexImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i, arg9bv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glTexParameter") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
+        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -4821,188 +3858,365 @@ Gua_Status Gl_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
             return GUA_ERROR;
         }
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        
-        glTexParameterf(arg1i, arg2i, arg3f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glTexSubImage2D") == 0) {
-        if (argc != 10) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        arg3fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    }
+    
+    if ((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL)) {
+        glLightf(arg1i, arg2i, arg3f);
+    } else {
+        glLightfv(arg1i, arg2i, arg3fv);
+    }
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 7 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[9]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlLightModelFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlLightModel function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlLightModelFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLdouble arg2f;
+    GLfloat *arg2fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    arg2f = 0.0;
+    
+    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5i = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5i = roundl(Gua_ObjectToReal(argv[5]));            
-        }
-        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-            arg6i = Gua_ObjectToInteger(argv[6]);
-        } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
-            arg6i = roundl(Gua_ObjectToReal(argv[6]));            
-        }
-        if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
-            arg7i = Gua_ObjectToInteger(argv[7]);
-        } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
-            arg7i = roundl(Gua_ObjectToReal(argv[7]));            
-        }
-        if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
-            arg8i = Gua_ObjectToInteger(argv[8]);
-        } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
-            arg8i = roundl(Gua_ObjectToReal(argv[8]));            
-        }
-                
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[9]);
+        return GUA_ERROR;
+    }
+
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_HANDLE) {
+        h = (Gua_Handle *)Gua_ObjectToHandle(argv[2]);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
+        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
         
-        arg9bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
+        arg2fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    }
+    
+    if ((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        glLightModelf(arg1i, arg2f);
+    } else {
+        glLightModelfv(arg1i, arg2fv);
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlLineWidthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlLineWidth function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlLineWidthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
+    }
+    
+    glLineWidth(arg1f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlListBaseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlListBase function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlListBaseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1d;
+    
+    Gua_ClearPObject(object);
+    
+    arg1d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
+    }
+    
+    glListBase(arg1d);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlLoadIdentityFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlLoadIdentity function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlLoadIdentityFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glLoadIdentity();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlLoadMatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlLoadMatrix function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlLoadMatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLfloat *arg1fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glLoadMatrixf(arg1fv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlLogicOpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlLogicOp function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlLogicOpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glLogicOp(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlMaterialFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlMaterial function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlMaterialFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLdouble arg3f;
+    GLfloat *arg3fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    arg3f = 0.0;
+    
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glTexSubImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i, arg9bv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glTranslate") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE) {
+        h = (Gua_Handle *)Gua_ObjectToHandle(argv[3]);
         
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
+        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -5011,263 +4225,477 @@ Gua_Status Gl_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
             return GUA_ERROR;
         }
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1f = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1f = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2f = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2f = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        
-        glTranslatef(arg1f, arg2f, arg3f);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glVertex") == 0) {
-        if (!((argc >= 2) && (argc <= 5))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        arg3fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    }
+    
+    if ((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL)) {
+        glMaterialf(arg1i, arg2i, arg3f);
+    } else {
+        glMaterialfv(arg1i, arg2i, arg3fv);
+    }
+    
+    return GUA_OK;
+}
 
-        if (argc >= 2) {
-		    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-                arg1f = Gua_ObjectToInteger(argv[1]);
-            } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-                arg1f = Gua_ObjectToReal(argv[1]);            
-            } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE) {
-                h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-                
-                if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-                    errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                    sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-                    strcat(error, errMessage);
-                    Gua_Free(errMessage);
-                    
-                    return GUA_ERROR;
-                }
-                
-                arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
-            }
-        }
-        if (argc >= 3) {
-		    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-                arg2f = Gua_ObjectToInteger(argv[2]);
-            } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-                arg2f = Gua_ObjectToReal(argv[2]);            
-            }
-        }
-        if (argc >= 4) {
-		    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-                arg3f = Gua_ObjectToInteger(argv[3]);
-            } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-                arg3f = Gua_ObjectToReal(argv[3]);            
-            }
-        }
-        if (argc == 5) {
-            if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-                arg4f = Gua_ObjectToInteger(argv[4]);
-            } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-                arg4f = Gua_ObjectToReal(argv[4]);            
-            }
-        }
-        if (argc == 2) {
-            if (Gua_ObjectLength(argv[1]) == 2) {
-                glVertex2fv(arg1fv);
-            } else if (Gua_ObjectLength(argv[1]) == 3) {
-                glVertex3fv(arg1fv);
-            } else if (Gua_ObjectLength(argv[1]) == 4) {
-                glVertex4fv(arg1fv);
-            }
-        } else if (argc == 3) {
-            glVertex2f(arg1f, arg2f);
-        } else if (argc == 4) {
-            glVertex3f(arg1f, arg2f, arg3f);
-        } else if (argc == 5) {
-            glVertex4f(arg1f, arg2f, arg3f, arg4f);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glVertexPointer") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlMatrixModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlMatrixMode function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlMatrixModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    
+    glMatrixMode(arg1i);
+    
+    return GUA_OK;
+}
 
-	    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!(Gua_ObjectType(argv[4]) == OBJECT_TYPE_HANDLE)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        /*
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        */
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+#ifndef _WINDOWS_
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlMultiTexCoordFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlMultiTexCoord function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlMultiTexCoordFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    GLdouble arg4f;
+    GLdouble arg5f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    arg2f = 0.0;
+    arg3f = 0.0;
+    arg4f = 0.0;
+    arg5f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4f = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4f = Gua_ObjectToReal(argv[4]);            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5f = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5f = Gua_ObjectToReal(argv[5]);            
+    }
+    
+    glMultiTexCoord4f(arg1i, arg2f, arg3f, arg4f, arg5f);
+    
+    return GUA_OK;
+}
+#endif
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlMultMatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlMultMatrix function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlMultMatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLfloat *arg1fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+	    if (!(Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg4fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glVertexPointer(arg1i, GL_FLOAT, arg3i, arg4fv);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glViewport") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glMultMatrixf(arg1fv);
+    
+    return GUA_OK;
+}
 
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-		if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-		if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-		if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlNewListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlNewList function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlNewListFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    glNewList(arg1i, arg2i);
+    
+    return GUA_OK;
+}
 
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlNormalFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlNormal function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlNormalFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    }
+    
+    glNormal3f(arg1f, arg2f, arg3f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlNormalPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlNormalPointer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlNormalPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg2i;
+    GLfloat *arg3fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg2i = 0;
+    
+    if (!(Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    /*
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    */
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[3]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glViewport(arg1i, arg2i, arg3i, arg4i);
+        return GUA_ERROR;
+    }
+    
+    arg3fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glNormalPointer(GL_FLOAT, arg2i, arg3fv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlOrthoFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlOrtho function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlOrthoFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    GLdouble arg4f;
+    GLdouble arg5f;
+    GLdouble arg6f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    arg4f = 0.0;
+    arg5f = 0.0;
+    arg6f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4f = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4f = Gua_ObjectToReal(argv[4]);            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5f = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5f = Gua_ObjectToReal(argv[5]);            
+    }
+    if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+        arg6f = Gua_ObjectToInteger(argv[6]);
+    } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
+        arg6f = Gua_ObjectToReal(argv[6]);            
+    }
+    
+    glOrtho(arg1f, arg2f, arg3f, arg4f, arg5f, arg6f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlPixelStoreFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlPixelStore function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlPixelStoreFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-
+    
+    glPixelStorei(arg1i, arg2i);
+    
     return GUA_OK;
 }
 
@@ -5276,777 +4704,1871 @@ Gua_Status Gl_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gu
  *     C
  *
  * Function:
- *     Gua_Status Gl_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *     Gua_Status Gl_GlPointParameterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Install the extension functions.
+ *     GlPointParameter function wrapper.
  *
  * Arguments:
- *     nspace,    a pointer to a structure containing the variable and function namespace;
- *     argc,      the number of command line arguments;
- *     argv,      the command line arguments;
- *     env,       a pointer to the environment variables;
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
  *     error,     a pointer to the error message.
  *
  * Results:
- *     Install the extension functions.
+ *     The return object of the wrapped function.
  */
-Gua_Status Gl_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+Gua_Status Gl_GlPointParameterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Function function;
-    Gua_Object object;
-    Gua_String errMessage;
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
 
-    /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glActiveTexture", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glActiveTexture");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glAlphaFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glAlphaFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glArrayOfByte", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glArrayOfByte");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glArrayOfInt", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glArrayOfInt");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glArrayOfFloat", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glArrayOfFloat");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glBegin", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glBegin");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glBindBuffer", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glBindBuffer");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glBindTexture", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glBindTexture");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glBlendFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glBlendFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glBufferData", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glBufferData");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glBufferSubData", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glBufferSubData");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glCallList", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glCallList");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glClear", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glClear");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glClearColor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glClearColor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glClearDepth", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glClearDepth");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glClearStencil", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glClearStencil");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glClientActiveTexture", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glClientActiveTexture");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glClipPlane", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glClipPlane");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glColor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glColor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glColorMask", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glColorMask");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glColorMaterial", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glColorMaterial");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glColorPointer", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glColorPointer");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glCompressedTexImage2D", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glCompressedTexImage2D");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glCompressedTexSubImage2D", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glCompressedTexSubImage2D");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glCopyTexImage2D", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glCopyTexImage2D");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glCopyTexSubImage2D", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glCopyTexSubImage2D");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glCullFace", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glCullFace");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDeleteBuffers", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDeleteBuffers");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDeleteLists", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDeleteLists");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDeleteTextures", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDeleteTextures");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDepthFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDepthFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDepthMask", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDepthMask");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDepthRange", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDepthRange");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDisable", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDisable");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDisableClientState", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDisableClientState");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDrawArrays", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDrawArrays");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glDrawElements", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glDrawElements");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glEnable", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glEnable");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glEnableClientState", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glEnableClientState");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glEnd", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glEnd");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glEndList", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glEndList");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glFinish", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glFinish");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glFlush", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glFlush");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glFog", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glFog");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glFree", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glFree");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glFrontFace", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glFrontFace");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glFrustum", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glFrustum");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGenBuffers", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGenBuffers");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGenLists", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGenLists");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGenTextures", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGenTextures");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGet", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGet");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGetBufferParameteriv", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGetBufferParameteriv");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGetClipPlane", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGetClipPlane");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlPointSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlPointSize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlPointSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGetError", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGetError");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glPointSize(arg1f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlPolygonOffsetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlPolygonOffset function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlPolygonOffsetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGetLight", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGetLightfv");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGetMaterial", &function) != GUA_OK) {
+    
+    glPolygonOffset(arg1f, arg2f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlPopMatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlPopMatrix function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlPopMatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glPopMatrix();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlPushMatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlPushMatrix function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlPushMatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glPushMatrix();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlRasterPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlRasterPos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlRasterPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    GLdouble arg4f;
+    GLfloat *arg1fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    arg4f = 0.0;
+    
+    if (!((argc >= 2) && (argc <= 5))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGetMaterialfv");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGetPointerv", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGetPointerv");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    if (argc >= 2) {
+		    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+            arg1f = Gua_ObjectToInteger(argv[1]);
+        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+            arg1f = Gua_ObjectToReal(argv[1]);            
+        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE) {
+            h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+            
+            if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
+                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+                strcat(error, errMessage);
+                Gua_Free(errMessage);
+                
+                return GUA_ERROR;
+            }
+            
+            arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGetString", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGetString");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc >= 3) {
+		    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+            arg2f = Gua_ObjectToInteger(argv[2]);
+        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+            arg2f = Gua_ObjectToReal(argv[2]);            
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGetTexEnv", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGetTexEnvfv");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc >= 4) {
+		    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+            arg3f = Gua_ObjectToInteger(argv[3]);
+        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+            arg3f = Gua_ObjectToReal(argv[3]);            
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glGetTexParameter", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glGetTexParameterfv");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc == 5) {
+        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+            arg4f = Gua_ObjectToInteger(argv[4]);
+        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+            arg4f = Gua_ObjectToReal(argv[4]);            
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glHint", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glHint");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc == 2) {
+        if (Gua_ObjectLength(argv[1]) == 2) {
+            glRasterPos2fv(arg1fv);
+        } else if (Gua_ObjectLength(argv[1]) == 3) {
+            glRasterPos3fv(arg1fv);
+        } else if (Gua_ObjectLength(argv[1]) == 4) {
+            glRasterPos4fv(arg1fv);
+        }
+    } else if (argc == 3) {
+        glRasterPos2f(arg1f, arg2f);
+    } else if (argc == 4) {
+        glRasterPos3f(arg1f, arg2f, arg3f);
+    } else if (argc == 5) {
+        glRasterPos4f(arg1f, arg2f, arg3f, arg4f);
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glIsBuffer", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glIsBuffer");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlReadPixelsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlReadPixels function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlReadPixelsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlRotateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlRotate function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlRotateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    GLdouble arg4f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    arg4f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4f = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4f = Gua_ObjectToReal(argv[4]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glIsEnabled", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glIsEnabled");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glRotatef(arg1f, arg2f, arg3f, arg4f);
+    
+    return GUA_OK;
+}
+
+#ifndef _WINDOWS_
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlSampleCoverageFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlSampleCoverage function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlSampleCoverageFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg2i;
+    GLdouble arg1f;
+    
+    Gua_ClearPObject(object);
+    
+    arg2i = 0;
+    
+    arg1f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glIsList", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glIsList");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glIsTexture", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glIsTexture");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glSampleCoverage(arg1f, arg2i);
+    
+    return GUA_OK;
+}
+#endif
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlScaleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlScale function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlScaleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glLight", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glLight");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glLightModel", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glLightModel");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glLineWidth", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glLineWidth");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glScalef(arg1f, arg2f, arg3f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlScissorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlScissor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlScissorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLint arg4i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glListBase", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glListBase");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glScissor(arg1i, arg2i, arg3i, arg4i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlShadeModelFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlShadeModel function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlShadeModelFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glLoadIdentity", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glLoadIdentity");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glShadeModel(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlStencilFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlStencilFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlStencilFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glLoadMatrix", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glLoadMatrix");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glLogicOp", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glLogicOp");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glMaterial", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glMaterial");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glStencilFunc(arg1i, arg2i, arg3i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlStencilMaskFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlStencilMask function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlStencilMaskFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glMatrixMode", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glMatrixMode");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glStencilMask(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlStencilOpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlStencilOp function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlStencilOpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glMultiTexCoord", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glMultiTexCoord");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glMultMatrix", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glMultMatrix");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glNewList", &function) != GUA_OK) {
+    
+    glStencilOp(arg1i, arg2i, arg3i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlTexCoordFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlTexCoord function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlTexCoordFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    GLdouble arg4f;
+    GLfloat *arg1fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    arg4f = 0.0;
+    
+    if (!((argc >= 2) && (argc <= 5))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glNewList");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glNormal", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glNormal");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+
+    if (argc >= 2) {
+		    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+            arg1f = Gua_ObjectToInteger(argv[1]);
+        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+            arg1f = Gua_ObjectToReal(argv[1]);            
+        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_MATRIX) {
+            h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+            
+            if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
+                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+                strcat(error, errMessage);
+                Gua_Free(errMessage);
+                
+                return GUA_ERROR;
+            }
+            
+            arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glNormalPointer", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glNormalPointer");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc >= 3) {
+		    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+            arg2f = Gua_ObjectToInteger(argv[2]);
+        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+            arg2f = Gua_ObjectToReal(argv[2]);            
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glOrtho", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glOrtho");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc >= 4) {
+		    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+            arg3f = Gua_ObjectToInteger(argv[3]);
+        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+            arg3f = Gua_ObjectToReal(argv[3]);            
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glPixelStore", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glPixelStore");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc == 5) {
+        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+            arg4f = Gua_ObjectToInteger(argv[4]);
+        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+            arg4f = Gua_ObjectToReal(argv[4]);            
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glPointParameter", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glPointParameter");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc == 2) {
+        if (Gua_ObjectLength(argv[1]) == 2) {
+            glTexCoord2fv(arg1fv);
+        } else if (Gua_ObjectLength(argv[1]) == 3) {
+            glTexCoord3fv(arg1fv);
+        } else if (Gua_ObjectLength(argv[1]) == 4) {
+            glTexCoord4fv(arg1fv);
+        }
+    } else if (argc == 3) {
+        glTexCoord2f(arg1f, arg2f);
+    } else if (argc == 4) {
+        glTexCoord3f(arg1f, arg2f, arg3f);
+    } else if (argc == 5) {
+        glTexCoord4f(arg1f, arg2f, arg3f, arg4f);
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glPointSize", &function) != GUA_OK) {
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlTexCoordPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlTexCoordPointer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlTexCoordPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg3i;
+    GLfloat *arg4fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg3i = 0;
+    
+    if (!(Gua_ObjectType(argv[4]) == OBJECT_TYPE_HANDLE)) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glPointSize");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glPolygonOffset", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glPolygonOffset");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    /*
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    */
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glPopMatrix", &function) != GUA_OK) {
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glPopMatrix");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glPushMatrix", &function) != GUA_OK) {
+    
+    arg4fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glTexCoordPointer(arg1i, GL_FLOAT, arg3i, arg4fv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlTexEnvFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlTexEnv function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlTexEnvFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLdouble arg3f;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    arg3f = 0.0;
+    
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glPushMatrix");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glRasterPos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glRasterPos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glReadPixels", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glReadPixels");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glRotate", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glRotate");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glSampleCoverage", &function) != GUA_OK) {
+    
+    glTexEnvf(arg1i, arg2i, arg3f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlTexGenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlTexGen function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlTexGenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLdouble arg3f;
+    GLfloat *arg3fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    arg3f = 0.0;
+    
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glSampleCoverage");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glScale", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glScale");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE) {
+        h = (Gua_Handle *)Gua_ObjectToHandle(argv[3]);
+        
+        if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        
+        arg3fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glScissor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glScissor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        glTexGenf(arg1i, arg2i, arg3f);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_HANDLE) {
+        glTexGenfv(arg1i, arg2i, arg3fv);
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glShadeModel", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glShadeModel");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlTexImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlTexImage2D function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlTexImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLint arg4i;
+    GLint arg5i;
+    GLint arg6i;
+    GLint arg7i;
+    GLint arg8i;
+    GLbyte *arg9bv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    arg5i = 0;
+    arg6i = 0;
+    arg7i = 0;
+    arg8i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5i = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5i = roundl(Gua_ObjectToReal(argv[5]));            
+    }
+    if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+        arg6i = Gua_ObjectToInteger(argv[6]);
+    } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
+        arg6i = roundl(Gua_ObjectToReal(argv[6]));            
+    }
+    if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
+        arg7i = Gua_ObjectToInteger(argv[7]);
+    } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
+        arg7i = roundl(Gua_ObjectToReal(argv[7]));            
+    }
+    if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
+        arg8i = Gua_ObjectToInteger(argv[8]);
+    } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
+        arg8i = roundl(Gua_ObjectToReal(argv[8]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glStencilFunc", &function) != GUA_OK) {
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[9]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glStencilFunc");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glStencilMask", &function) != GUA_OK) {
+    
+    arg9bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glTexImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i, arg9bv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlTexParameterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlTexParameter function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlTexParameterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLdouble arg3f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    arg3f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    }
+    
+    glTexParameterf(arg1i, arg2i, arg3f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlTexSubImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlTexSubImage2D function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlTexSubImage2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLint arg4i;
+    GLint arg5i;
+    GLint arg6i;
+    GLint arg7i;
+    GLint arg8i;
+    GLbyte *arg9bv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    arg5i = 0;
+    arg6i = 0;
+    arg7i = 0;
+    arg8i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5i = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5i = roundl(Gua_ObjectToReal(argv[5]));            
+    }
+    if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+        arg6i = Gua_ObjectToInteger(argv[6]);
+    } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
+        arg6i = roundl(Gua_ObjectToReal(argv[6]));            
+    }
+    if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
+        arg7i = Gua_ObjectToInteger(argv[7]);
+    } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
+        arg7i = roundl(Gua_ObjectToReal(argv[7]));            
+    }
+    if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
+        arg8i = Gua_ObjectToInteger(argv[8]);
+    } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
+        arg8i = roundl(Gua_ObjectToReal(argv[8]));            
+    }
+            
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[9]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfByte") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glStencilMask");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    arg9bv = (GLbyte *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glTexSubImage2D(arg1i, arg2i, arg3i, arg4i, arg5i, arg6i, arg7i, arg8i, arg9bv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlTranslateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlTranslate function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlTranslateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1f = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1f = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glStencilOp", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glStencilOp");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2f = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2f = Gua_ObjectToReal(argv[2]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glTexCoord", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glTexCoord");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glTexCoordPointer", &function) != GUA_OK) {
+    
+    glTranslatef(arg1f, arg2f, arg3f);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlVertexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlVertex function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlVertexFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1f;
+    GLdouble arg2f;
+    GLdouble arg3f;
+    GLdouble arg4f;
+    GLfloat *arg1fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1f = 0.0;
+    arg2f = 0.0;
+    arg3f = 0.0;
+    arg4f = 0.0;
+    
+    if (!((argc >= 2) && (argc <= 5))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glTexCoordPointer");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glTexEnv", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glTexEnv");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+
+    if (argc >= 2) {
+		    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+            arg1f = Gua_ObjectToInteger(argv[1]);
+        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+            arg1f = Gua_ObjectToReal(argv[1]);            
+        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_HANDLE) {
+            h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+            
+            if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
+                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+                strcat(error, errMessage);
+                Gua_Free(errMessage);
+                
+                return GUA_ERROR;
+            }
+            
+            arg1fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glTexGen", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glTexGen");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc >= 3) {
+		    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+            arg2f = Gua_ObjectToInteger(argv[2]);
+        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+            arg2f = Gua_ObjectToReal(argv[2]);            
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glTexImage2D", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glTexImage2D");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc >= 4) {
+		    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+            arg3f = Gua_ObjectToInteger(argv[3]);
+        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+            arg3f = Gua_ObjectToReal(argv[3]);            
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glTexParameter", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glTexParameter");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc == 5) {
+        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
+            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+            strcat(error, errMessage);
+            Gua_Free(errMessage);
+            
+            return GUA_ERROR;
+        }
+        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+            arg4f = Gua_ObjectToInteger(argv[4]);
+        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+            arg4f = Gua_ObjectToReal(argv[4]);            
+        }
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glTexSubImage2D", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glTexSubImage2D");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (argc == 2) {
+        if (Gua_ObjectLength(argv[1]) == 2) {
+            glVertex2fv(arg1fv);
+        } else if (Gua_ObjectLength(argv[1]) == 3) {
+            glVertex3fv(arg1fv);
+        } else if (Gua_ObjectLength(argv[1]) == 4) {
+            glVertex4fv(arg1fv);
+        }
+    } else if (argc == 3) {
+        glVertex2f(arg1f, arg2f);
+    } else if (argc == 4) {
+        glVertex3f(arg1f, arg2f, arg3f);
+    } else if (argc == 5) {
+        glVertex4f(arg1f, arg2f, arg3f, arg4f);
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glTranslate", &function) != GUA_OK) {
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlVertexPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlVertexPointer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlVertexPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg3i;
+    GLfloat *arg4fv;
+    Gua_Handle *h;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg3i = 0;
+    
+    if (!(Gua_ObjectType(argv[4]) == OBJECT_TYPE_HANDLE)) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glTranslate");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glVertex", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glVertex");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    /*
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    */
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glVertexPointer", &function) != GUA_OK) {
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "glArrayOfFloat") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glVertexPointer");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Gl_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glViewport", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glViewport");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    arg4fv = (GLfloat *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glVertexPointer(arg1i, GL_FLOAT, arg3i, arg4fv);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_GlViewportFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlViewport function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Gl_GlViewportFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg1i;
+    GLint arg2i;
+    GLint arg3i;
+    GLint arg4i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
     }
+    
+    glViewport(arg1i, arg2i, arg3i, arg4i);
+    
+    return GUA_OK;
+}
+
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Gl_Functions[] = {
+#ifndef _WINDOWS_
+    {"glActiveTexture", Gl_GlActiveTextureFunctionWrapper, 2, "n"},
+#endif
+    {"glAlphaFunc", Gl_GlAlphaFuncFunctionWrapper, 3, "nn"},
+    {"glArrayOfByte", Gl_GlArrayOfByteFunctionWrapper, 2, NULL},
+    {"glArrayOfInt", Gl_GlArrayOfIntFunctionWrapper, 2, NULL},
+    {"glArrayOfFloat", Gl_GlArrayOfFloatFunctionWrapper, 2, NULL},
+    {"glBegin", Gl_GlBeginFunctionWrapper, 2, "n"},
+    {"glBindBuffer", Gl_GlBindBufferFunctionWrapper, 0, NULL},
+    {"glBindTexture", Gl_GlBindTextureFunctionWrapper, 3, "nn"},
+    {"glBlendFunc", Gl_GlBlendFuncFunctionWrapper, 3, "nn"},
+    {"glBufferData", Gl_GlBufferDataFunctionWrapper, 0, NULL},
+    {"glBufferSubData", Gl_GlBufferSubDataFunctionWrapper, 0, NULL},
+    {"glCallList", Gl_GlCallListFunctionWrapper, 2, "n"},
+    {"glClear", Gl_GlClearFunctionWrapper, 2, "n"},
+    {"glClearColor", Gl_GlClearColorFunctionWrapper, 5, "nnnn"},
+    {"glClearDepth", Gl_GlClearDepthFunctionWrapper, 2, "n"},
+    {"glClearStencil", Gl_GlClearStencilFunctionWrapper, 2, "n"},
+#ifndef _WINDOWS_
+    {"glClientActiveTexture", Gl_GlClientActiveTextureFunctionWrapper, 2, "n"},
+#endif
+    {"glClipPlane", Gl_GlClipPlaneFunctionWrapper, 0, NULL},
+    {"glColor", Gl_GlColorFunctionWrapper, 5, "nnnn"},
+    {"glColorMask", Gl_GlColorMaskFunctionWrapper, 5, "nnnn"},
+    {"glColorMaterial", Gl_GlColorMaterialFunctionWrapper, 3, "nn"},
+    {"glColorPointer", Gl_GlColorPointerFunctionWrapper, 5, "nnn"},
+#ifndef _WINDOWS_
+    {"glCompressedTexImage2D", Gl_GlCompressedTexImage2DFunctionWrapper, 9, "nnnnnnnh"},
+    {"glCompressedTexSubImage2D", Gl_GlCompressedTexSubImage2DFunctionWrapper, 10, "nnnnnnnnh"},
+#endif
+    {"glCopyTexImage2D", Gl_GlCopyTexImage2DFunctionWrapper, 9, "nnnnnnnn"},
+    {"glCopyTexSubImage2D", Gl_GlCopyTexSubImage2DFunctionWrapper, 9, "nnnnnnnn"},
+    {"glCullFace", Gl_GlCullFaceFunctionWrapper, 2, "n"},
+    {"glDeleteBuffers", Gl_GlDeleteBuffersFunctionWrapper, 0, NULL},
+    {"glDeleteLists", Gl_GlDeleteListsFunctionWrapper, 3, "nn"},
+    {"glDeleteTextures", Gl_GlDeleteTexturesFunctionWrapper, 3, "n"},
+    {"glDepthFunc", Gl_GlDepthFuncFunctionWrapper, 2, "n"},
+    {"glDepthMask", Gl_GlDepthMaskFunctionWrapper, 2, "n"},
+    {"glDepthRange", Gl_GlDepthRangeFunctionWrapper, 3, "nn"},
+    {"glDisable", Gl_GlDisableFunctionWrapper, 2, "n"},
+    {"glDisableClientState", Gl_GlDisableClientStateFunctionWrapper, 2, "n"},
+    {"glDrawArrays", Gl_GlDrawArraysFunctionWrapper, 4, "nnn"},
+    {"glDrawElements", Gl_GlDrawElementsFunctionWrapper, 5, "nnn"},
+    {"glEnable", Gl_GlEnableFunctionWrapper, 2, "n"},
+    {"glEnableClientState", Gl_GlEnableClientStateFunctionWrapper, 2, "n"},
+    {"glEnd", Gl_GlEndFunctionWrapper, 1, NULL},
+    {"glEndList", Gl_GlEndListFunctionWrapper, 1, NULL},
+    {"glFinish", Gl_GlFinishFunctionWrapper, 1, NULL},
+    {"glFlush", Gl_GlFlushFunctionWrapper, 1, NULL},
+    {"glFog", Gl_GlFogFunctionWrapper, 3, "n"},
+    {"glFree", Gl_GlFreeFunctionWrapper, 2, "h"},
+    {"glFrontFace", Gl_GlFrontFaceFunctionWrapper, 2, "n"},
+    {"glFrustum", Gl_GlFrustumFunctionWrapper, 7, "nnnnnn"},
+    {"glGenBuffers", Gl_GlGenBuffersFunctionWrapper, 0, NULL},
+    {"glGenLists", Gl_GlGenListsFunctionWrapper, 2, "n"},
+    {"glGenTextures", Gl_GlGenTexturesFunctionWrapper, 2, "n"},
+    {"glGet", Gl_GlGetFunctionWrapper, 2, "n"},
+    {"glGetBufferParameteriv", Gl_GlGetBufferParameterivFunctionWrapper, 0, NULL},
+    {"glGetClipPlane", Gl_GlGetClipPlaneFunctionWrapper, 2, "n"},
+    {"glGetError", Gl_GlGetErrorFunctionWrapper, 1, NULL},
+    {"glGetLight", Gl_GlGetLightFunctionWrapper, 3, "nn"},
+    {"glGetMaterial", Gl_GlGetMaterialFunctionWrapper, 3, "nn"},
+    {"glGetPointerv", Gl_GlGetPointervFunctionWrapper, 0, NULL},
+    {"glGetString", Gl_GlGetStringFunctionWrapper, 2, "n"},
+    {"glGetTexEnv", Gl_GlGetTexEnvFunctionWrapper, 3, "nn"},
+    {"glGetTexParameter", Gl_GlGetTexParameterFunctionWrapper, 3, "nn"},
+    {"glHint", Gl_GlHintFunctionWrapper, 3, "nn"},
+    {"glIsBuffer", Gl_GlIsBufferFunctionWrapper, 0, NULL},
+    {"glIsEnabled", Gl_GlIsEnabledFunctionWrapper, 2, "n"},
+    {"glIsList", Gl_GlIsListFunctionWrapper, 2, "n"},
+    {"glIsTexture", Gl_GlIsTextureFunctionWrapper, 2, "n"},
+    {"glLight", Gl_GlLightFunctionWrapper, 4, "nn"},
+    {"glLightModel", Gl_GlLightModelFunctionWrapper, 3, "n"},
+    {"glLineWidth", Gl_GlLineWidthFunctionWrapper, 2, "n"},
+    {"glListBase", Gl_GlListBaseFunctionWrapper, 2, "n"},
+    {"glLoadIdentity", Gl_GlLoadIdentityFunctionWrapper, 1, NULL},
+    {"glLoadMatrix", Gl_GlLoadMatrixFunctionWrapper, 2, NULL},
+    {"glLogicOp", Gl_GlLogicOpFunctionWrapper, 2, "n"},
+    {"glMaterial", Gl_GlMaterialFunctionWrapper, 4, "nn"},
+    {"glMatrixMode", Gl_GlMatrixModeFunctionWrapper, 2, "n"},
+#ifndef _WINDOWS_
+    {"glMultiTexCoord", Gl_GlMultiTexCoordFunctionWrapper, 6, "nnnnn"},
+#endif
+    {"glMultMatrix", Gl_GlMultMatrixFunctionWrapper, 2, NULL},
+    {"glNewList", Gl_GlNewListFunctionWrapper, 3, "nn"},
+    {"glNormal", Gl_GlNormalFunctionWrapper, 4, "nnn"},
+    {"glNormalPointer", Gl_GlNormalPointerFunctionWrapper, 4, "nn"},
+    {"glOrtho", Gl_GlOrthoFunctionWrapper, 7, "nnnnnn"},
+    {"glPixelStore", Gl_GlPixelStoreFunctionWrapper, 3, "nn"},
+    {"glPointParameter", Gl_GlPointParameterFunctionWrapper, 0, NULL},
+    {"glPointSize", Gl_GlPointSizeFunctionWrapper, 2, "n"},
+    {"glPolygonOffset", Gl_GlPolygonOffsetFunctionWrapper, 3, "nn"},
+    {"glPopMatrix", Gl_GlPopMatrixFunctionWrapper, 1, NULL},
+    {"glPushMatrix", Gl_GlPushMatrixFunctionWrapper, 1, NULL},
+    {"glRasterPos", Gl_GlRasterPosFunctionWrapper, 0, NULL},
+    {"glReadPixels", Gl_GlReadPixelsFunctionWrapper, 0, NULL},
+    {"glRotate", Gl_GlRotateFunctionWrapper, 5, "nnnn"},
+#ifndef _WINDOWS_
+    {"glSampleCoverage", Gl_GlSampleCoverageFunctionWrapper, 3, "nn"},
+#endif
+    {"glScale", Gl_GlScaleFunctionWrapper, 4, "nnn"},
+    {"glScissor", Gl_GlScissorFunctionWrapper, 5, "nnnn"},
+    {"glShadeModel", Gl_GlShadeModelFunctionWrapper, 2, "n"},
+    {"glStencilFunc", Gl_GlStencilFuncFunctionWrapper, 4, "nnn"},
+    {"glStencilMask", Gl_GlStencilMaskFunctionWrapper, 2, "n"},
+    {"glStencilOp", Gl_GlStencilOpFunctionWrapper, 4, "nnn"},
+    {"glTexCoord", Gl_GlTexCoordFunctionWrapper, 0, NULL},
+    {"glTexCoordPointer", Gl_GlTexCoordPointerFunctionWrapper, 5, "nnn"},
+    {"glTexEnv", Gl_GlTexEnvFunctionWrapper, 4, "nn"},
+    {"glTexGen", Gl_GlTexGenFunctionWrapper, 4, "nn"},
+    {"glTexImage2D", Gl_GlTexImage2DFunctionWrapper, 10, "nnnnnnnnh"},
+    {"glTexParameter", Gl_GlTexParameterFunctionWrapper, 4, "nnn"},
+    {"glTexSubImage2D", Gl_GlTexSubImage2DFunctionWrapper, 10, "nnnnnnnnh"},
+    {"glTranslate", Gl_GlTranslateFunctionWrapper, 4, "nnn"},
+    {"glVertex", Gl_GlVertexFunctionWrapper, 0, NULL},
+    {"glVertexPointer", Gl_GlVertexPointerFunctionWrapper, 5, "nnn"},
+    {"glViewport", Gl_GlViewportFunctionWrapper, 5, "nnnn"},
+    {NULL, NULL, 0, NULL}
+};
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Gl_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *
+ * Description:
+ *     Install the extension functions.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure containing the variable and function namespace;
+ *     argc,      the number of command line arguments;
+ *     argv,      the command line arguments;
+ *     env,       a pointer to the environment variables;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Install the extension functions.
+ */
+Gua_Status Gl_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+{
+    Gua_Object object;
+    Gua_String errMessage;
+
+    /* Define the function wrapper to each extension function... */
+    Gua_SetFunctions((Gua_Namespace *)nspace, Gl_Functions, error);
 
     /* Define each extension constant... */
 #ifndef _WINDOWS_
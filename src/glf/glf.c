@@ -44,10 +44,10 @@
  *     C
  *
  * Function:
- *     Gua_Status Glf_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Glf_GlfDrawTextFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     GlfDrawText function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -60,19 +60,8 @@
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Glf_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Glf_GlfDrawTextFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_String errMessage;
-    
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-
-        return GUA_ERROR;
-    }
-
     /**
      * Group:
      *     Scripting
@@ -86,55 +75,17 @@ Gua_Status Glf_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
      * Examples:
      *     glfDrawText(0.0, 0.7, $script_path + "/fonts/6x13.bdf", "Hello World!").
      */
-    if (strcmp(Gua_ObjectToString(argv[0]), "glfDrawText") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[4]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Glft_DrawText(Gua_ObjectToReal(argv[1]), Gua_ObjectToReal(argv[2]), Gua_ObjectToString(argv[3]), Gua_ObjectToString(argv[4])));
-    }
+    Gua_IntegerToPObject(object, Glft_DrawText(Gua_ObjectToReal(argv[1]), Gua_ObjectToReal(argv[2]), Gua_ObjectToString(argv[3]), Gua_ObjectToString(argv[4])));
     
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Glf_Functions[] = {
+    {"glfDrawText", Glf_GlfDrawTextFunctionWrapper, 5, "nnss"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -157,18 +108,11 @@ Gua_Status Glf_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
  */
 Gua_Status Glf_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
 
     /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Glf_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfDrawText", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfDrawText");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Glf_Functions, error);
     
     /* Define each extension constant... */
     
@@ -36,7 +36,6 @@
 #include "glfw.h"
 
 #define EXPRESSION_SIZE  4096
-#define ERROR_SIZE  65536
 
 Gua_Namespace *globalNameSpace;
 
@@ -78,27 +77,26 @@ void Glfw_GLFWcharfun(GLFWwindow *window, unsigned int codepoint)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLFW_CHARCALLBACK[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(globalNameSpace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(globalNameSpace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 3;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -113,8 +111,7 @@ void Glfw_GLFWcharfun(GLFWwindow *window, unsigned int codepoint)
     /* Pass the other function argument. */
     Gua_IntegerToObject(argv[2], codepoint);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(globalNameSpace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -144,13 +141,13 @@ void Glfw_GLFWcharfun(GLFWwindow *window, unsigned int codepoint)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -192,27 +189,26 @@ void Glfw_GLFWcharmodsfun(GLFWwindow *window, unsigned int codepoint, int mods)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLFW_CHARMODSCALLBACK[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(globalNameSpace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(globalNameSpace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 4;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -228,8 +224,7 @@ void Glfw_GLFWcharmodsfun(GLFWwindow *window, unsigned int codepoint, int mods)
     Gua_IntegerToObject(argv[2], codepoint);
     Gua_IntegerToObject(argv[3], mods);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(globalNameSpace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -259,13 +254,13 @@ void Glfw_GLFWcharmodsfun(GLFWwindow *window, unsigned int codepoint, int mods)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -306,27 +301,26 @@ void Glfw_GLFWcursorenterfun(GLFWwindow *window, int entered)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLFW_CURSORENTERCALLBACK[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(globalNameSpace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(globalNameSpace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 3;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -341,8 +335,7 @@ void Glfw_GLFWcursorenterfun(GLFWwindow *window, int entered)
     /* Pass the other function argument. */
     Gua_IntegerToObject(argv[2], entered);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(globalNameSpace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -372,13 +365,13 @@ void Glfw_GLFWcursorenterfun(GLFWwindow *window, int entered)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -420,27 +413,26 @@ void Glfw_GLFWcursorposfun(GLFWwindow *window, double xpos, double ypos)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLFW_CURSORPOSCALLBACK[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(globalNameSpace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(globalNameSpace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 4;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -456,8 +448,7 @@ void Glfw_GLFWcursorposfun(GLFWwindow *window, double xpos, double ypos)
     Gua_RealToObject(argv[2], xpos);
     Gua_RealToObject(argv[3], ypos);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(globalNameSpace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -487,13 +478,13 @@ void Glfw_GLFWcursorposfun(GLFWwindow *window, double xpos, double ypos)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -536,30 +527,29 @@ void Glfw_GLFWdropfun(GLFWwindow *window, int count, const char **names)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLFW_DROPCALLBACK[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(globalNameSpace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(globalNameSpace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Convert an array of strings to a GuaraScript array object. */
     Gua_ArgvToArray(count, (char **)names, &array);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 4;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -575,8 +565,7 @@ void Glfw_GLFWdropfun(GLFWwindow *window, int count, const char **names)
     Gua_IntegerToObject(argv[2], count);
     Gua_LinkObjects(argv[3], array);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(globalNameSpace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -606,13 +595,13 @@ void Glfw_GLFWdropfun(GLFWwindow *window, int count, const char **names)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -643,8 +632,7 @@ void Glfw_GLFWerrorfun(int error, const char *description)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLFW_ERRORCALLBACK + \"(%d, \"%s\");\")", error, description);
     
-    errMessage = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *errMessage = '\0';
+    errMessage = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, errMessage);
@@ -656,13 +644,13 @@ void Glfw_GLFWerrorfun(int error, const char *description)
         printf("\nError: %s", errMessage);
         
         Gua_Free(expression);
-        Gua_Free(errMessage);
+        Gua_FreeErrorBuffer(errMessage);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(errMessage);
+    Gua_FreeErrorBuffer(errMessage);
 }
 
 /**
@@ -706,27 +694,26 @@ void Glfw_GLFWkeyfun(GLFWwindow *window, int key, int scancode, int action, int
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLFW_KEYCALLBACK[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(globalNameSpace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(globalNameSpace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 6;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -744,8 +731,7 @@ void Glfw_GLFWkeyfun(GLFWwindow *window, int key, int scancode, int action, int
     Gua_IntegerToObject(argv[4], action);
     Gua_IntegerToObject(argv[5], mods);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(globalNameSpace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -775,13 +761,65 @@ void Glfw_GLFWkeyfun(GLFWwindow *window, int key, int scancode, int action, int
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwCreateCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwCreateCursor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwCreateCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwCreateStandardCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwCreateStandardCursor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwCreateStandardCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
 }
 
 /**
@@ -789,10 +827,10 @@ void Glfw_GLFWkeyfun(GLFWwindow *window, int key, int scancode, int action, int
  *     C
  *
  * Function:
- *     Gua_Status Glfw_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Glfw_GlfwCreateWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     GlfwCreateWindow function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -805,803 +843,359 @@ void Glfw_GLFWkeyfun(GLFWwindow *window, int key, int scancode, int action, int
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Glfw_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Glfw_GlfwCreateWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
     Gua_Handle *h;
-    int arg2i;
-    int arg3i;
-    void *arg1p;
     void *arg4p;
     void *arg5p;
     GLFWwindow *window;
-    Gua_String expression;
-    Gua_String p;
-    Gua_Status status;
-    Gua_Object o;
     Gua_String errMessage;
     
-    arg2i = 0;
-    arg3i = 0;
-    
-    arg1p = NULL;
     arg4p = NULL;
     arg5p = NULL;
     
-    if (argc == 0) {
+    if (argc < 4) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
-
+        
         return GUA_ERROR;
     }
-
-    if (strcmp(Gua_ObjectToString(argv[0]), "glfwCreateCursor") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwCreateStandardCursor") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwCreateWindow") == 0) {
-        if (argc < 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
+    
 		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (argc >= 5) {
-            h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
-            
-            if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWmonitor") != 0) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            
-            arg4p = Gua_GetHandlePointer((Gua_Handle *)h);
-        }
-        
-        if (argc == 6) {
-            h = (Gua_Handle *)Gua_ObjectToHandle(argv[5]);
-            
-            if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            
-            arg5p = Gua_GetHandlePointer((Gua_Handle *)h);
-        }
-        
-        window = (GLFWwindow *)glfwCreateWindow(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2]), Gua_ObjectToString(argv[3]), (GLFWmonitor *)arg4p,  (GLFWwindow *)arg5p);
-        
-        Gua_NewHandle(h, "GLFWwindow", window);
-        
-        Gua_HandleToPObject(object, (struct Gua_Handle *)h);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwDefaultWindowHints") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwDestroyCursor") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwDestroyWindow") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        glfwDestroyWindow((GLFWwindow *)arg1p);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwExtensionSupported") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetClipboardString") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetCurrentContext") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetCursorPos") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetFramebufferSize") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    if (argc >= 5) {
+        h = (Gua_Handle *)Gua_ObjectToHandle(argv[4]);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
+        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWmonitor") != 0) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        arg4p = Gua_GetHandlePointer((Gua_Handle *)h);
+    }
+    
+    if (argc == 6) {
+        h = (Gua_Handle *)Gua_ObjectToHandle(argv[5]);
         
         if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
         
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glfwGetFramebufferSize((GLFWwindow *)arg1p, &arg2i, &arg3i);
-        
-        Gua_IntegerToObject(o, arg2i);
-        Gua_SetStoredObject(o);
-        if (Gua_SetVariable((Gua_Namespace *)nspace, Gua_ObjectToString(argv[2]), &o, SCOPE_STACK) != GUA_OK) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "can't set variable", Gua_ObjectToString(argv[2]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-        }
+        arg5p = Gua_GetHandlePointer((Gua_Handle *)h);
+    }
+    
+    window = (GLFWwindow *)glfwCreateWindow(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2]), Gua_ObjectToString(argv[3]), (GLFWmonitor *)arg4p,  (GLFWwindow *)arg5p);
+    
+    Gua_NewHandle(h, "GLFWwindow", window);
+    
+    Gua_HandleToPObject(object, (struct Gua_Handle *)h);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwDefaultWindowHintsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwDefaultWindowHints function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwDefaultWindowHintsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwDestroyCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwDestroyCursor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwDestroyCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwDestroyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwDestroyWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwDestroyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_IntegerToObject(o, arg3i);
-        Gua_SetStoredObject(o);
-        if (Gua_SetVariable((Gua_Namespace *)nspace, Gua_ObjectToString(argv[3]), &o, SCOPE_STACK) != GUA_OK) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "can't set variable", Gua_ObjectToString(argv[3]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetGammaRamp") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetInputMode") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetJoystickAxes") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetJoystickButtons") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetJoystickName") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetKey") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetMonitorName") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetMonitorPhysicalSize") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetMonitorPos") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetMonitors") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetMouseButton") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetPrimaryMonitor") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetProcAddress") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetTime") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_RealToPObject(object, glfwGetTime());
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetVersion") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetVersionString") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetVideoMode") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetVideoModes") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetWindowAttrib") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetWindowFrameSize") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetWindowMonitor") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetWindowPos") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetWindowSize") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwGetWindowUserPointer") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwHideWindow") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwIconifyWindow") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwInit") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwJoystickPresent") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwMakeContextCurrent") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glfwMakeContextCurrent((GLFWwindow *)arg1p);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwPollEvents") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glfwPollEvents();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwPostEmptyEvent") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwRestoreWindow") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetCharCallback") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLFW_CHARCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glfwSetCharCallback((GLFWwindow *)arg1p, (GLFWcharfun)Glfw_GLFWcharfun);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetCharModsCallback") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLFW_CHARMODSCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glfwSetCharModsCallback((GLFWwindow *)arg1p, (GLFWcharmodsfun)Glfw_GLFWcharmodsfun);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetClipboardString") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetCursor") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetCursorEnterCallback") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glfwDestroyWindow((GLFWwindow *)arg1p);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwExtensionSupportedFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwExtensionSupported function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwExtensionSupportedFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetClipboardStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetClipboardString function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetClipboardStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetCurrentContextFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetCurrentContext function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetCurrentContextFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetCursorPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetCursorPos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetCursorPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetFramebufferSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetFramebufferSize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetFramebufferSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    int arg2i;
+    int arg3i;
+    void *arg1p;
+    Gua_Object o;
+    Gua_String errMessage;
+    
+    arg2i = 0;
+    arg3i = 0;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLFW_CURSORENTERCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glfwSetCursorEnterCallback((GLFWwindow *)arg1p, (GLFWcursorenterfun)Glfw_GLFWcursorenterfun);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetCursorPos") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetCursorPosCallback") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLFW_CURSORPOSCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glfwSetCursorPosCallback((GLFWwindow *)arg1p, (GLFWcursorposfun)Glfw_GLFWcursorposfun);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetDropCallback") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLFW_DROPCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glfwSetDropCallback((GLFWwindow *)arg1p, (GLFWdropfun)Glfw_GLFWdropfun);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetErrorCallback") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLFW_ERRORCALLBACK = \"%s\";", Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glfwSetErrorCallback((GLFWerrorfun)Glfw_GLFWerrorfun);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetFramebufferSizeCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetGamma") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetGammaRamp") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetInputMode") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetKeyCallback") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLFW_KEYCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glfwSetKeyCallback((GLFWwindow *)arg1p, (GLFWkeyfun)Glfw_GLFWkeyfun);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetMonitorCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetMouseButtonCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetScrollCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetTime") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowCloseCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowFocusCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowIconifyCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowPos") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowPosCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowRefreshCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowShouldClose") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glfwSetWindowShouldClose((GLFWwindow *)arg1p, Gua_ObjectToInteger(argv[2]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowSize") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowSizeCallback") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowTitle") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSetWindowUserPointer") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwShowWindow") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSwapBuffers") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        glfwSwapBuffers((GLFWwindow *)arg1p);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwSwapInterval") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glfwSwapInterval(Gua_ObjectToInteger(argv[1]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwTerminate") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glfwTerminate();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwWaitEvents") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwWindowHint") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glfwWindowShouldClose") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        Gua_IntegerToPObject(object, glfwWindowShouldClose((GLFWwindow *)arg1p));
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glfwGetFramebufferSize((GLFWwindow *)arg1p, &arg2i, &arg3i);
+    
+    Gua_IntegerToObject(o, arg2i);
+    Gua_SetStoredObject(o);
+    if (Gua_SetVariable((Gua_Namespace *)nspace, Gua_ObjectToString(argv[2]), &o, SCOPE_STACK) != GUA_OK) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "can't set variable", Gua_ObjectToString(argv[2]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+    }
+    
+    Gua_IntegerToObject(o, arg3i);
+    Gua_SetStoredObject(o);
+    if (Gua_SetVariable((Gua_Namespace *)nspace, Gua_ObjectToString(argv[3]), &o, SCOPE_STACK) != GUA_OK) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "can't set variable", Gua_ObjectToString(argv[3]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
     }
     
     return GUA_OK;
@@ -1612,583 +1206,2201 @@ Gua_Status Glfw_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv,
  *     C
  *
  * Function:
- *     Gua_Status Glfw_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *     Gua_Status Glfw_GlfwGetGammaRampFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Install the extension functions.
+ *     GlfwGetGammaRamp function wrapper.
  *
  * Arguments:
- *     nspace,    a pointer to a structure containing the variable and function namespace;
- *     argc,      the number of command line arguments;
- *     argv,      the command line arguments;
- *     env,       a pointer to the environment variables;
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
  *     error,     a pointer to the error message.
  *
  * Results:
- *     Install the extension functions.
+ *     The return object of the wrapped function.
  */
-Gua_Status Glfw_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+Gua_Status Glfw_GlfwGetGammaRampFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Function function;
-    Gua_Object object;
-    Gua_String errMessage;
-    
-    globalNameSpace = nspace;
-    
-    /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwCreateCursor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwCreateCursor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwCreateStandardCursor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwCreateStandardCursor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwCreateWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwCreateWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwDefaultWindowHints", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwDefaultWindowHints");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwDestroyCursor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwDestroyCursor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwDestroyWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwDestroyWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwExtensionSupported", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwExtensionSupported");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetClipboardString", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetClipboardString");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetCurrentContext", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetCurrentContext");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetCursorPos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetCursorPos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetFramebufferSize", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetFramebufferSize");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetGammaRamp", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetGammaRamp");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetInputMode", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetInputMode");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetJoystickAxes", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetJoystickAxes");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetJoystickButtons", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetJoystickButtons");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetJoystickName", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetJoystickName");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetKey", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetKey");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetMonitorName", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetMonitorName");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetMonitorPhysicalSize", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetMonitorPhysicalSize");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetMonitorPos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetMonitorPos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetMonitors", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetMonitors");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetMouseButton", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetMouseButton");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetPrimaryMonitor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetPrimaryMonitor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetProcAddress", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetProcAddress");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetTime", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetTime");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetVersion", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetVersion");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetVersionString", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetVersionString");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetVideoMode", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetVideoMode");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetVideoModes", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetVideoModes");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetWindowAttrib", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetWindowAttrib");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetWindowFrameSize", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetWindowFrameSize");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetWindowMonitor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetWindowMonitor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetWindowPos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetWindowPos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetWindowSize", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetWindowSize");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwGetWindowUserPointer", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwGetWindowUserPointer");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwHideWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwHideWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwIconifyWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwIconifyWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwInit", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwInit");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwJoystickPresent", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwJoystickPresent");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwMakeContextCurrent", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwMakeContextCurrent");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwPollEvents", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwPollEvents");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwPostEmptyEvent", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwPostEmptyEvent");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwRestoreWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwRestoreWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetCharCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetCharCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetCharModsCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetCharModsCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetClipboardString", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetClipboardString");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetCursor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetCursor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetCursorEnterCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetCursorEnterCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetCursorPos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetCursorPos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetCursorPosCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetCursorPosCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetDropCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetDropCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetErrorCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetErrorCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetFramebufferSizeCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetFramebufferSizeCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetGamma", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetGamma");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetGammaRamp", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetGammaRamp");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetInputMode", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetInputMode");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetKeyCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetKeyCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetMonitorCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetMonitorCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetMouseButtonCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetMouseButtonCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetScrollCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetScrollCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetTime", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetTime");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowCloseCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowCloseCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowFocusCallback", &function) != GUA_OK) {
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetInputModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetInputMode function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetInputModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetJoystickAxesFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetJoystickAxes function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetJoystickAxesFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetJoystickButtonsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetJoystickButtons function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetJoystickButtonsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetJoystickNameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetJoystickName function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetJoystickNameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetKeyFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetKey function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetKeyFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetMonitorNameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetMonitorName function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetMonitorNameFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetMonitorPhysicalSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetMonitorPhysicalSize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetMonitorPhysicalSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetMonitorPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetMonitorPos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetMonitorPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetMonitorsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetMonitors function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetMonitorsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetMouseButtonFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetMouseButton function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetMouseButtonFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetPrimaryMonitorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetPrimaryMonitor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetPrimaryMonitorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetProcAddressFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetProcAddress function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetProcAddressFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetTimeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetTime function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetTimeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_RealToPObject(object, glfwGetTime());
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetVersionFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetVersion function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetVersionFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetVersionStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetVersionString function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetVersionStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetVideoModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetVideoMode function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetVideoModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetVideoModesFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetVideoModes function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetVideoModesFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetWindowAttribFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetWindowAttrib function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetWindowAttribFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetWindowFrameSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetWindowFrameSize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetWindowFrameSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetWindowMonitorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetWindowMonitor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetWindowMonitorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetWindowPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetWindowPos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetWindowPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetWindowSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetWindowSize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetWindowSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwGetWindowUserPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwGetWindowUserPointer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwGetWindowUserPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwHideWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwHideWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwHideWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwIconifyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwIconifyWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwIconifyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwInitFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwInit function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwInitFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwJoystickPresentFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwJoystickPresent function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwJoystickPresentFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwMakeContextCurrentFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwMakeContextCurrent function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwMakeContextCurrentFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowFocusCallback");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowIconifyCallback", &function) != GUA_OK) {
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glfwMakeContextCurrent((GLFWwindow *)arg1p);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwPollEventsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwPollEvents function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwPollEventsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    glfwPollEvents();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwPostEmptyEventFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwPostEmptyEvent function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwPostEmptyEventFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwRestoreWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwRestoreWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwRestoreWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetCharCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetCharCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetCharCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowIconifyCallback");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowPos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowPos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLFW_CHARCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowPosCallback", &function) != GUA_OK) {
+    
+    Gua_Free(expression);
+    
+    glfwSetCharCallback((GLFWwindow *)arg1p, (GLFWcharfun)Glfw_GLFWcharfun);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetCharModsCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetCharModsCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetCharModsCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowPosCallback");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowRefreshCallback", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowRefreshCallback");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLFW_CHARMODSCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowShouldClose", &function) != GUA_OK) {
+    
+    Gua_Free(expression);
+    
+    glfwSetCharModsCallback((GLFWwindow *)arg1p, (GLFWcharmodsfun)Glfw_GLFWcharmodsfun);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetClipboardStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetClipboardString function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetClipboardStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetCursor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetCursorEnterCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetCursorEnterCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetCursorEnterCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowShouldClose");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowSize", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowSize");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLFW_CURSORENTERCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowSizeCallback", &function) != GUA_OK) {
+    
+    Gua_Free(expression);
+    
+    glfwSetCursorEnterCallback((GLFWwindow *)arg1p, (GLFWcursorenterfun)Glfw_GLFWcursorenterfun);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetCursorPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetCursorPos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetCursorPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetCursorPosCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetCursorPosCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetCursorPosCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowSizeCallback");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowTitle", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowTitle");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLFW_CURSORPOSCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSetWindowUserPointer", &function) != GUA_OK) {
+    
+    Gua_Free(expression);
+    
+    glfwSetCursorPosCallback((GLFWwindow *)arg1p, (GLFWcursorposfun)Glfw_GLFWcursorposfun);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetDropCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetDropCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetDropCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSetWindowUserPointer");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwShowWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwShowWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLFW_DROPCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSwapBuffers", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSwapBuffers");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glfwSetDropCallback((GLFWwindow *)arg1p, (GLFWdropfun)Glfw_GLFWdropfun);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetErrorCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetErrorCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetErrorCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLFW_ERRORCALLBACK = \"%s\";", Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwSwapInterval", &function) != GUA_OK) {
+    
+    Gua_Free(expression);
+    
+    glfwSetErrorCallback((GLFWerrorfun)Glfw_GLFWerrorfun);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetFramebufferSizeCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetFramebufferSizeCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetFramebufferSizeCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetGammaFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetGamma function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetGammaFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetGammaRampFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetGammaRamp function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetGammaRampFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetInputModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetInputMode function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetInputModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetKeyCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetKeyCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetKeyCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwSwapInterval");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwTerminate", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwTerminate");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLFW_KEYCALLBACK[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwWaitEvents", &function) != GUA_OK) {
+    
+    Gua_Free(expression);
+    
+    glfwSetKeyCallback((GLFWwindow *)arg1p, (GLFWkeyfun)Glfw_GLFWkeyfun);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetMonitorCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetMonitorCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetMonitorCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetMouseButtonCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetMouseButtonCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetMouseButtonCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetScrollCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetScrollCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetScrollCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetTimeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetTime function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetTimeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowCloseCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowCloseCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowCloseCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowFocusCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowFocusCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowFocusCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowIconifyCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowIconifyCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowIconifyCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowPos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowPosCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowPosCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowPosCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowRefreshCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowRefreshCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowRefreshCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowShouldCloseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowShouldClose function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowShouldCloseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwWaitEvents");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwWindowHint", &function) != GUA_OK) {
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glfwSetWindowShouldClose((GLFWwindow *)arg1p, Gua_ObjectToInteger(argv[2]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowSize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowSizeCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowSizeCallback function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowSizeCallbackFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowTitleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowTitle function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowTitleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSetWindowUserPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSetWindowUserPointer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSetWindowUserPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwShowWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwShowWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwShowWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSwapBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSwapBuffers function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSwapBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwWindowHint");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glfw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glfwWindowShouldClose", &function) != GUA_OK) {
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    glfwSwapBuffers((GLFWwindow *)arg1p);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwSwapIntervalFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwSwapInterval function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwSwapIntervalFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    glfwSwapInterval(Gua_ObjectToInteger(argv[1]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwTerminateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwTerminate function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwTerminateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    glfwTerminate();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwWaitEventsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwWaitEvents function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwWaitEventsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwWindowHintFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwWindowHint function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwWindowHintFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_GlfwWindowShouldCloseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlfwWindowShouldClose function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glfw_GlfwWindowShouldCloseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "GLFWwindow") != 0) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glfwWindowShouldClose");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Gua_IntegerToPObject(object, glfwWindowShouldClose((GLFWwindow *)arg1p));
+    
+    return GUA_OK;
+}
+
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Glfw_Functions[] = {
+    {"glfwCreateCursor", Glfw_GlfwCreateCursorFunctionWrapper, 0, NULL},
+    {"glfwCreateStandardCursor", Glfw_GlfwCreateStandardCursorFunctionWrapper, 0, NULL},
+    {"glfwCreateWindow", Glfw_GlfwCreateWindowFunctionWrapper, 0, NULL},
+    {"glfwDefaultWindowHints", Glfw_GlfwDefaultWindowHintsFunctionWrapper, 0, NULL},
+    {"glfwDestroyCursor", Glfw_GlfwDestroyCursorFunctionWrapper, 0, NULL},
+    {"glfwDestroyWindow", Glfw_GlfwDestroyWindowFunctionWrapper, 2, "h"},
+    {"glfwExtensionSupported", Glfw_GlfwExtensionSupportedFunctionWrapper, 0, NULL},
+    {"glfwGetClipboardString", Glfw_GlfwGetClipboardStringFunctionWrapper, 0, NULL},
+    {"glfwGetCurrentContext", Glfw_GlfwGetCurrentContextFunctionWrapper, 0, NULL},
+    {"glfwGetCursorPos", Glfw_GlfwGetCursorPosFunctionWrapper, 0, NULL},
+    {"glfwGetFramebufferSize", Glfw_GlfwGetFramebufferSizeFunctionWrapper, 4, "hss"},
+    {"glfwGetGammaRamp", Glfw_GlfwGetGammaRampFunctionWrapper, 0, NULL},
+    {"glfwGetInputMode", Glfw_GlfwGetInputModeFunctionWrapper, 0, NULL},
+    {"glfwGetJoystickAxes", Glfw_GlfwGetJoystickAxesFunctionWrapper, 0, NULL},
+    {"glfwGetJoystickButtons", Glfw_GlfwGetJoystickButtonsFunctionWrapper, 0, NULL},
+    {"glfwGetJoystickName", Glfw_GlfwGetJoystickNameFunctionWrapper, 0, NULL},
+    {"glfwGetKey", Glfw_GlfwGetKeyFunctionWrapper, 0, NULL},
+    {"glfwGetMonitorName", Glfw_GlfwGetMonitorNameFunctionWrapper, 0, NULL},
+    {"glfwGetMonitorPhysicalSize", Glfw_GlfwGetMonitorPhysicalSizeFunctionWrapper, 0, NULL},
+    {"glfwGetMonitorPos", Glfw_GlfwGetMonitorPosFunctionWrapper, 0, NULL},
+    {"glfwGetMonitors", Glfw_GlfwGetMonitorsFunctionWrapper, 0, NULL},
+    {"glfwGetMouseButton", Glfw_GlfwGetMouseButtonFunctionWrapper, 0, NULL},
+    {"glfwGetPrimaryMonitor", Glfw_GlfwGetPrimaryMonitorFunctionWrapper, 0, NULL},
+    {"glfwGetProcAddress", Glfw_GlfwGetProcAddressFunctionWrapper, 0, NULL},
+    {"glfwGetTime", Glfw_GlfwGetTimeFunctionWrapper, 1, NULL},
+    {"glfwGetVersion", Glfw_GlfwGetVersionFunctionWrapper, 0, NULL},
+    {"glfwGetVersionString", Glfw_GlfwGetVersionStringFunctionWrapper, 0, NULL},
+    {"glfwGetVideoMode", Glfw_GlfwGetVideoModeFunctionWrapper, 0, NULL},
+    {"glfwGetVideoModes", Glfw_GlfwGetVideoModesFunctionWrapper, 0, NULL},
+    {"glfwGetWindowAttrib", Glfw_GlfwGetWindowAttribFunctionWrapper, 0, NULL},
+    {"glfwGetWindowFrameSize", Glfw_GlfwGetWindowFrameSizeFunctionWrapper, 0, NULL},
+    {"glfwGetWindowMonitor", Glfw_GlfwGetWindowMonitorFunctionWrapper, 0, NULL},
+    {"glfwGetWindowPos", Glfw_GlfwGetWindowPosFunctionWrapper, 0, NULL},
+    {"glfwGetWindowSize", Glfw_GlfwGetWindowSizeFunctionWrapper, 0, NULL},
+    {"glfwGetWindowUserPointer", Glfw_GlfwGetWindowUserPointerFunctionWrapper, 0, NULL},
+    {"glfwHideWindow", Glfw_GlfwHideWindowFunctionWrapper, 0, NULL},
+    {"glfwIconifyWindow", Glfw_GlfwIconifyWindowFunctionWrapper, 0, NULL},
+    {"glfwInit", Glfw_GlfwInitFunctionWrapper, 0, NULL},
+    {"glfwJoystickPresent", Glfw_GlfwJoystickPresentFunctionWrapper, 0, NULL},
+    {"glfwMakeContextCurrent", Glfw_GlfwMakeContextCurrentFunctionWrapper, 2, "h"},
+    {"glfwPollEvents", Glfw_GlfwPollEventsFunctionWrapper, 1, NULL},
+    {"glfwPostEmptyEvent", Glfw_GlfwPostEmptyEventFunctionWrapper, 0, NULL},
+    {"glfwRestoreWindow", Glfw_GlfwRestoreWindowFunctionWrapper, 0, NULL},
+    {"glfwSetCharCallback", Glfw_GlfwSetCharCallbackFunctionWrapper, 3, "hs"},
+    {"glfwSetCharModsCallback", Glfw_GlfwSetCharModsCallbackFunctionWrapper, 3, "hs"},
+    {"glfwSetClipboardString", Glfw_GlfwSetClipboardStringFunctionWrapper, 0, NULL},
+    {"glfwSetCursor", Glfw_GlfwSetCursorFunctionWrapper, 0, NULL},
+    {"glfwSetCursorEnterCallback", Glfw_GlfwSetCursorEnterCallbackFunctionWrapper, 3, "hs"},
+    {"glfwSetCursorPos", Glfw_GlfwSetCursorPosFunctionWrapper, 0, NULL},
+    {"glfwSetCursorPosCallback", Glfw_GlfwSetCursorPosCallbackFunctionWrapper, 3, "hs"},
+    {"glfwSetDropCallback", Glfw_GlfwSetDropCallbackFunctionWrapper, 3, "hs"},
+    {"glfwSetErrorCallback", Glfw_GlfwSetErrorCallbackFunctionWrapper, 2, "s"},
+    {"glfwSetFramebufferSizeCallback", Glfw_GlfwSetFramebufferSizeCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetGamma", Glfw_GlfwSetGammaFunctionWrapper, 0, NULL},
+    {"glfwSetGammaRamp", Glfw_GlfwSetGammaRampFunctionWrapper, 0, NULL},
+    {"glfwSetInputMode", Glfw_GlfwSetInputModeFunctionWrapper, 0, NULL},
+    {"glfwSetKeyCallback", Glfw_GlfwSetKeyCallbackFunctionWrapper, 3, "hs"},
+    {"glfwSetMonitorCallback", Glfw_GlfwSetMonitorCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetMouseButtonCallback", Glfw_GlfwSetMouseButtonCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetScrollCallback", Glfw_GlfwSetScrollCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetTime", Glfw_GlfwSetTimeFunctionWrapper, 0, NULL},
+    {"glfwSetWindowCloseCallback", Glfw_GlfwSetWindowCloseCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetWindowFocusCallback", Glfw_GlfwSetWindowFocusCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetWindowIconifyCallback", Glfw_GlfwSetWindowIconifyCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetWindowPos", Glfw_GlfwSetWindowPosFunctionWrapper, 0, NULL},
+    {"glfwSetWindowPosCallback", Glfw_GlfwSetWindowPosCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetWindowRefreshCallback", Glfw_GlfwSetWindowRefreshCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetWindowShouldClose", Glfw_GlfwSetWindowShouldCloseFunctionWrapper, 3, "hi"},
+    {"glfwSetWindowSize", Glfw_GlfwSetWindowSizeFunctionWrapper, 0, NULL},
+    {"glfwSetWindowSizeCallback", Glfw_GlfwSetWindowSizeCallbackFunctionWrapper, 0, NULL},
+    {"glfwSetWindowTitle", Glfw_GlfwSetWindowTitleFunctionWrapper, 0, NULL},
+    {"glfwSetWindowUserPointer", Glfw_GlfwSetWindowUserPointerFunctionWrapper, 0, NULL},
+    {"glfwShowWindow", Glfw_GlfwShowWindowFunctionWrapper, 0, NULL},
+    {"glfwSwapBuffers", Glfw_GlfwSwapBuffersFunctionWrapper, 2, "h"},
+    {"glfwSwapInterval", Glfw_GlfwSwapIntervalFunctionWrapper, 2, "i"},
+    {"glfwTerminate", Glfw_GlfwTerminateFunctionWrapper, 1, NULL},
+    {"glfwWaitEvents", Glfw_GlfwWaitEventsFunctionWrapper, 0, NULL},
+    {"glfwWindowHint", Glfw_GlfwWindowHintFunctionWrapper, 0, NULL},
+    {"glfwWindowShouldClose", Glfw_GlfwWindowShouldCloseFunctionWrapper, 2, "h"},
+    {NULL, NULL, 0, NULL}
+};
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glfw_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *
+ * Description:
+ *     Install the extension functions.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure containing the variable and function namespace;
+ *     argc,      the number of command line arguments;
+ *     argv,      the command line arguments;
+ *     env,       a pointer to the environment variables;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Install the extension functions.
+ */
+Gua_Status Glfw_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+{
+    Gua_Object object;
+    Gua_String errMessage;
+    
+    globalNameSpace = nspace;
+    
+    /* Define the function wrapper to each extension function... */
+    Gua_SetFunctions((Gua_Namespace *)nspace, Glfw_Functions, error);
 
     /* Define each extension constant... */
     Gua_IntegerToObject(object, GLFW_ACCUM_ALPHA_BITS);
@@ -191,10 +191,10 @@ Gua_Status Glo_SavePPM(Gua_String file, Gua_String image, Gua_Short width, Gua_S
  *     C
  *
  * Function:
- *     Gua_Status Glo_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Glo_GloLoadObjFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     GloLoadObj function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -207,31 +207,18 @@ Gua_Status Glo_SavePPM(Gua_String file, Gua_String image, Gua_Short width, Gua_S
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Glo_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Glo_GloLoadObjFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
     GLint arg2i;
-    GLint arg3i;
     GLfloat arg3f;
     GLMmodel *model;
     GLuint model_list;
-    Gua_Object o;
-    FILE *fp;
-    Gua_String errMessage;
     
     arg2i = 0;
     arg3f = 0.0;
     model = NULL;
     model_list = 0;
     
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-
-        return GUA_ERROR;
-    }
-    
     /**
      * Group:
      *     Scripting
@@ -245,63 +232,62 @@ Gua_Status Glo_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
      * Examples:
      *     output == annProcess(ann, input, dim_in_j, dim_out_j).
      */
-    if (strcmp(Gua_ObjectToString(argv[0]), "gloLoadObj") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3f = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3f = Gua_ObjectToReal(argv[3]);            
-        }
-        
-        /*
-         * Reads the model data, defines its vertices normals
-         * and create an OpenGL list to reference the object.
-         */
-        model = glmReadOBJ(Gua_ObjectToString(argv[1]));
-        glmUnitize(model);
-        glmFacetNormals(model);
-        glmVertexNormals(model, arg3f);
-        model_list = glmList(model, arg2i);
-        
-        Gua_IntegerToPObject(object, model_list);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3f = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3f = Gua_ObjectToReal(argv[3]);            
+    }
+    
+    /*
+     * Reads the model data, defines its vertices normals
+     * and create an OpenGL list to reference the object.
+     */
+    model = glmReadOBJ(Gua_ObjectToString(argv[1]));
+    glmUnitize(model);
+    glmFacetNormals(model);
+    glmVertexNormals(model, arg3f);
+    model_list = glmList(model, arg2i);
+    
+    Gua_IntegerToPObject(object, model_list);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glo_GloLoadPPMFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GloLoadPPM function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glo_GloLoadPPMFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLint arg2i;
+    GLint arg3i;
+    Gua_Object o;
+    Gua_String errMessage;
+    
+    arg2i = 0;
+    
     /**
      * Group:
      *     Scripting
@@ -315,60 +301,71 @@ Gua_Status Glo_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
      * Examples:
      *     texture = gloLoadPPM($texture_file, "texture_width", "texture_height").
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "gloLoadPPM") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_LinkByteArrayToPObject(object, (Gua_String)Glo_LoadPPM(Gua_ObjectToString(argv[1]), &arg2i, &arg3i), arg2i * arg3i * 3);
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_IntegerToObject(o, arg2i);
-        Gua_SetStoredObject(o);
-        if (Gua_SetVariable((Gua_Namespace *)nspace, Gua_ObjectToString(argv[2]), &o, SCOPE_STACK) != GUA_OK) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "can't set variable", Gua_ObjectToString(argv[2]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_IntegerToObject(o, arg3i);
-        Gua_SetStoredObject(o);
-        if (Gua_SetVariable((Gua_Namespace *)nspace, Gua_ObjectToString(argv[3]), &o, SCOPE_STACK) != GUA_OK) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "can't set variable", Gua_ObjectToString(argv[3]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-        }
+        return GUA_ERROR;
+    }
+    
+    Gua_LinkByteArrayToPObject(object, (Gua_String)Glo_LoadPPM(Gua_ObjectToString(argv[1]), &arg2i, &arg3i), arg2i * arg3i * 3);
+    
+    Gua_IntegerToObject(o, arg2i);
+    Gua_SetStoredObject(o);
+    if (Gua_SetVariable((Gua_Namespace *)nspace, Gua_ObjectToString(argv[2]), &o, SCOPE_STACK) != GUA_OK) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "can't set variable", Gua_ObjectToString(argv[2]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+    }
+    
+    Gua_IntegerToObject(o, arg3i);
+    Gua_SetStoredObject(o);
+    if (Gua_SetVariable((Gua_Namespace *)nspace, Gua_ObjectToString(argv[3]), &o, SCOPE_STACK) != GUA_OK) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "can't set variable", Gua_ObjectToString(argv[3]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glo_GloSavePPMFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GloSavePPM function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glo_GloSavePPMFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    FILE *fp;
+    
     /**
      * Group:
      *     Scripting
@@ -382,74 +379,38 @@ Gua_Status Glo_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
      * Examples:
      *     gloSavePPM(texture, "/tmp/texture.ppm", $texture_width, $texture_height).
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "gloSavePPM") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    /*
+     * Open the PPM image file.
+     */
+    fp = fopen(Gua_ObjectToString(argv[2]), "w+");
+    
+    if (fp != NULL) {
+        /*
+         * Writes the PPM file header.
+         */
+        fputs("P6\n", fp);
+        fprintf(fp, "%ld %ld\n", Gua_ObjectToInteger(argv[3]), Gua_ObjectToInteger(argv[4]));
+        fputs("255\n", fp);
         
         /*
-         * Open the PPM image file.
+         * Writes the raw image data.
          */
-        fp = fopen(Gua_ObjectToString(argv[2]), "w+");
+        fwrite(Gua_ObjectToString(argv[1]), sizeof(char), Gua_ObjectToInteger(argv[3]) * Gua_ObjectToInteger(argv[4]) * 3, fp);
         
-        if (fp != NULL) {
-            /*
-             * Writes the PPM file header.
-             */
-            fputs("P6\n", fp);
-            fprintf(fp, "%ld %ld\n", Gua_ObjectToInteger(argv[3]), Gua_ObjectToInteger(argv[4]));
-            fputs("255\n", fp);
-            
-            /*
-             * Writes the raw image data.
-             */
-            fwrite(Gua_ObjectToString(argv[1]), sizeof(char), Gua_ObjectToInteger(argv[3]) * Gua_ObjectToInteger(argv[4]) * 3, fp);
-            
-            fclose(fp);
-        }
+        fclose(fp);
     }
     
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Glo_Functions[] = {
+    {"gloLoadObj", Glo_GloLoadObjFunctionWrapper, 4, "snn"},
+    {"gloLoadPPM", Glo_GloLoadPPMFunctionWrapper, 4, "s"},
+    {"gloSavePPM", Glo_GloSavePPMFunctionWrapper, 5, "ssnn"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -472,32 +433,11 @@ Gua_Status Glo_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
  */
 Gua_Status Glo_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
 
     /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Glo_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gloLoadObj", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gloLoadObj");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glo_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gloLoadPPM", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gloLoadPPM");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glo_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gloSavePPM", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gloSavePPM");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Glo_Functions, error);
     
     /* Define each extension constant... */
     Gua_IntegerToObject(object, GLM_COLOR);
@@ -47,10 +47,10 @@
  *     C
  *
  * Function:
- *     Gua_Status Glu_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Glu_GluLookAtFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     GluLookAt function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -63,7 +63,7 @@
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Glu_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Glu_GluLookAtFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
     GLdouble arg1d;
     GLdouble arg2d;
@@ -88,250 +88,127 @@ Gua_Status Glu_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
     
     Gua_ClearPObject(object);
     
-    if (argc == 0) {
+    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
-
+        
         return GUA_ERROR;
     }
-
-    if (strcmp(Gua_ObjectToString(argv[0]), "gluLookAt") == 0) {
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 7 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[9]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[9]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2d = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2d = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3d = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3d = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4d = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4d = Gua_ObjectToReal(argv[4]);            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5d = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5d = Gua_ObjectToReal(argv[5]);            
-        }
-        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-            arg6d = Gua_ObjectToInteger(argv[6]);
-        } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
-            arg6d = Gua_ObjectToReal(argv[6]);            
-        }
-        if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
-            arg7d = Gua_ObjectToInteger(argv[7]);
-        } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
-            arg7d = Gua_ObjectToReal(argv[7]);            
-        }
-        if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
-            arg8d = Gua_ObjectToInteger(argv[8]);
-        } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
-            arg8d = Gua_ObjectToReal(argv[8]);            
-        }
-        if (Gua_ObjectType(argv[9]) == OBJECT_TYPE_INTEGER) {
-            arg9d = Gua_ObjectToInteger(argv[9]);
-        } else if (Gua_ObjectType(argv[9]) == OBJECT_TYPE_REAL) {
-            arg9d = Gua_ObjectToReal(argv[9]);            
-        }
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        gluLookAt(arg1d, arg2d, arg3d, arg4d, arg5d, arg6d, arg7d, arg8d, arg9d);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "gluOrtho2D") == 0) {
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2d = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2d = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3d = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3d = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4d = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4d = Gua_ObjectToReal(argv[4]);            
-        }
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 7 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        gluOrtho2D(arg1d, arg2d, arg3d, arg4d);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "gluPerspective") == 0) {
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 8 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2d = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2d = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3d = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3d = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4d = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4d = Gua_ObjectToReal(argv[4]);            
-        }
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[9]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[9]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 9 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        gluPerspective(arg1d, arg2d, arg3d, arg4d);
+        return GUA_ERROR;
     }
     
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2d = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2d = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3d = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3d = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4d = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4d = Gua_ObjectToReal(argv[4]);            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5d = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5d = Gua_ObjectToReal(argv[5]);            
+    }
+    if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+        arg6d = Gua_ObjectToInteger(argv[6]);
+    } else if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL) {
+        arg6d = Gua_ObjectToReal(argv[6]);            
+    }
+    if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_INTEGER) {
+        arg7d = Gua_ObjectToInteger(argv[7]);
+    } else if (Gua_ObjectType(argv[7]) == OBJECT_TYPE_REAL) {
+        arg7d = Gua_ObjectToReal(argv[7]);            
+    }
+    if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_INTEGER) {
+        arg8d = Gua_ObjectToInteger(argv[8]);
+    } else if (Gua_ObjectType(argv[8]) == OBJECT_TYPE_REAL) {
+        arg8d = Gua_ObjectToReal(argv[8]);            
+    }
+    if (Gua_ObjectType(argv[9]) == OBJECT_TYPE_INTEGER) {
+        arg9d = Gua_ObjectToInteger(argv[9]);
+    } else if (Gua_ObjectType(argv[9]) == OBJECT_TYPE_REAL) {
+        arg9d = Gua_ObjectToReal(argv[9]);            
+    }
+    
+    gluLookAt(arg1d, arg2d, arg3d, arg4d, arg5d, arg6d, arg7d, arg8d, arg9d);
+    
     return GUA_OK;
 }
 
@@ -340,49 +217,226 @@ Gua_Status Glu_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
  *     C
  *
  * Function:
- *     Gua_Status Glu_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *     Gua_Status Glu_GluOrtho2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Install the extension functions.
+ *     GluOrtho2D function wrapper.
  *
  * Arguments:
- *     nspace,    a pointer to a structure containing the variable and function namespace;
- *     argc,      the number of command line arguments;
- *     argv,      the command line arguments;
- *     env,       a pointer to the environment variables;
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
  *     error,     a pointer to the error message.
  *
  * Results:
- *     Install the extension functions.
+ *     The return object of the wrapped function.
  */
-Gua_Status Glu_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+Gua_Status Glu_GluOrtho2DFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Function function;
-    Gua_Object object;
+    GLdouble arg1d;
+    GLdouble arg2d;
+    GLdouble arg3d;
+    GLdouble arg4d;
     Gua_String errMessage;
+    
+    arg1d = 0.0;
+    arg2d = 0.0;
+    arg3d = 0.0;
+    arg4d = 0.0;
+    
+    Gua_ClearPObject(object);
+    
+    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2d = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2d = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3d = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3d = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4d = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4d = Gua_ObjectToReal(argv[4]);            
+    }
+    
+    gluOrtho2D(arg1d, arg2d, arg3d, arg4d);
+    
+    return GUA_OK;
+}
 
-    /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Glu_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gluLookAt", &function) != GUA_OK) {
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glu_GluPerspectiveFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GluPerspective function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glu_GluPerspectiveFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    GLdouble arg1d;
+    GLdouble arg2d;
+    GLdouble arg3d;
+    GLdouble arg4d;
+    Gua_String errMessage;
+    
+    arg1d = 0.0;
+    arg2d = 0.0;
+    arg3d = 0.0;
+    arg4d = 0.0;
+    
+    Gua_ClearPObject(object);
+    
+    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gluLookAt");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glu_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gluOrtho2D", &function) != GUA_OK) {
+    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gluOrtho2D");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glu_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gluPerspective", &function) != GUA_OK) {
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gluPerspective");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
+    if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2d = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2d = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3d = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3d = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4d = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4d = Gua_ObjectToReal(argv[4]);            
+    }
+    
+    gluPerspective(arg1d, arg2d, arg3d, arg4d);
+    
+    return GUA_OK;
+}
+
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Glu_Functions[] = {
+    {"gluLookAt", Glu_GluLookAtFunctionWrapper, 0, NULL},
+    {"gluOrtho2D", Glu_GluOrtho2DFunctionWrapper, 0, NULL},
+    {"gluPerspective", Glu_GluPerspectiveFunctionWrapper, 0, NULL},
+    {NULL, NULL, 0, NULL}
+};
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glu_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *
+ * Description:
+ *     Install the extension functions.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure containing the variable and function namespace;
+ *     argc,      the number of command line arguments;
+ *     argv,      the command line arguments;
+ *     env,       a pointer to the environment variables;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Install the extension functions.
+ */
+Gua_Status Glu_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+{
+    Gua_Object object;
+    Gua_String errMessage;
+
+    /* Define the function wrapper to each extension function... */
+    Gua_SetFunctions((Gua_Namespace *)nspace, Glu_Functions, error);
     
     /**
      * Group:
@@ -47,7 +47,6 @@
 #include "glut.h"
 
 #define EXPRESSION_SIZE  4096
-#define ERROR_SIZE  65536
 
 Gua_Namespace *globalNameSpace;
 
@@ -82,8 +81,7 @@ void Glut_ButtonBoxFunc(int button, int state)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_BUTTONBOXFUNC[%ld] + \"(%d, %d);\")", currentWindow, button, state);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -95,13 +93,13 @@ void Glut_ButtonBoxFunc(int button, int state)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -134,8 +132,7 @@ void Glut_CreateMenu(int value)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_CREATEMENU[%ld] + \"(%d);\")", currentWindow, value);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -147,13 +144,13 @@ void Glut_CreateMenu(int value)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -187,8 +184,7 @@ void Glut_DialsFunc(int dial, int value)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_DIALSFUNC[%ld] + \"(%d, %d);\")", currentWindow, dial, value);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -200,13 +196,13 @@ void Glut_DialsFunc(int dial, int value)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -236,8 +232,7 @@ void Glut_DisplayFunc(void)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_DISPLAYFUNC[%ld] + \"();\")", currentWindow);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -249,13 +244,13 @@ void Glut_DisplayFunc(void)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -288,8 +283,7 @@ void Glut_EntryFunc(int state)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_ENTRYFUNC[%ld] + \"(%d);\")", currentWindow, state);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -301,13 +295,13 @@ void Glut_EntryFunc(int state)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -337,8 +331,7 @@ void Glut_IdleFunc(void)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_IDLEFUNC[%ld] + \"();\")", currentWindow);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -350,13 +343,13 @@ void Glut_IdleFunc(void)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -391,8 +384,7 @@ void Glut_KeyboardFunc(unsigned char key, int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_KEYBOARDFUNC[%ld] + \"(%d, %d, %d);\")", currentWindow, key, x, y);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -404,13 +396,13 @@ void Glut_KeyboardFunc(unsigned char key, int x, int y)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -443,8 +435,7 @@ void Glut_MenuStateFunc(int s)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_MENUSTATEFUNC[%ld] + \"(%d);\")", currentWindow, s);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -456,13 +447,13 @@ void Glut_MenuStateFunc(int s)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -497,8 +488,7 @@ void Glut_MenuStatusFunc(int s, int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_MENUSTATUSFUNC[%ld] + \"(%d, %d, %d);\")", currentWindow, s, x, y);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -510,13 +500,13 @@ void Glut_MenuStatusFunc(int s, int x, int y)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -550,8 +540,7 @@ void Glut_MotionFunc(int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_MOTIONFUNC[%ld] + \"(%d, %d);\")", currentWindow, x, y);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -563,13 +552,13 @@ void Glut_MotionFunc(int x, int y)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -605,8 +594,7 @@ void Glut_MouseFunc(int button, int state, int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_MOUSEFUNC[%ld] + \"(%d, %d, %d, %d);\")", currentWindow, button, state, x, y);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -618,13 +606,13 @@ void Glut_MouseFunc(int button, int state, int x, int y)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -654,8 +642,7 @@ void Glut_OverlayDisplayFunc(void)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_OVERLAYDISPLAYFUNC[%ld] + \"();\")", currentWindow);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -667,13 +654,13 @@ void Glut_OverlayDisplayFunc(void)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -707,8 +694,7 @@ void Glut_PassiveMotionFunc(int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_PASSIVEMOTIONFUNC[%ld] + \"(%d, %d);\")", currentWindow, x, y);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -720,13 +706,13 @@ void Glut_PassiveMotionFunc(int x, int y)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -760,8 +746,7 @@ void Glut_ReshapeFunc(int width, int height)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_RESHAPEFUNC[%ld] + \"(%d, %d);\")", currentWindow, width, height);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -773,13 +758,13 @@ void Glut_ReshapeFunc(int width, int height)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -813,8 +798,7 @@ void Glut_SpaceballButtonFunc(int button, int state)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_SPACEBALLBUTTONFUNC[%ld] + \"(%d, %d);\")", currentWindow, button, state);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -826,13 +810,13 @@ void Glut_SpaceballButtonFunc(int button, int state)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -867,8 +851,7 @@ void Glut_SpaceballMotionFunc(int x, int y, int z)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_SPACEBALLMOTIONFUNC[%ld] + \"(%d, %d, %d);\")", currentWindow, x, y, z);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -880,13 +863,13 @@ void Glut_SpaceballMotionFunc(int x, int y, int z)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -921,8 +904,7 @@ void Glut_SpaceballRotateFunc(int x, int y, int z)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_SPACEBALLROTATEFUNC[%ld] + \"(%d, %d, %d);\")", currentWindow, x, y, z);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -934,13 +916,13 @@ void Glut_SpaceballRotateFunc(int x, int y, int z)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -975,8 +957,7 @@ void Glut_SpecialFunc(int key, int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_SPECIALFUNC[%ld] + \"(%d, %d, %d);\")", currentWindow, key, x, y);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -988,13 +969,13 @@ void Glut_SpecialFunc(int key, int x, int y)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -1030,8 +1011,7 @@ void Glut_TabletButtonFunc(int button, int state, int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_TABLETBUTTONFUNC[%ld] + \"(%d, %d, %d, %d);\")", currentWindow, button, state, x, y);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -1043,13 +1023,13 @@ void Glut_TabletButtonFunc(int button, int state, int x, int y)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -1083,8 +1063,7 @@ void Glut_TabletMotionFunc(int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_TABLETMOTIONFUNC[%ld] + \"(%d, %d);\")", currentWindow, x, y);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -1096,13 +1075,13 @@ void Glut_TabletMotionFunc(int x, int y)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -1135,8 +1114,7 @@ void Glut_TimerFunc(int value)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_TIMERFUNC[%ld] + \"(%d);\")", currentWindow, value);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -1148,13 +1126,13 @@ void Glut_TimerFunc(int value)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -1187,8 +1165,7 @@ void Glut_VisibilityFunc(int state)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "eval(GLUT_VISIBILITYFUNC[%ld] + \"(%d);\")", currentWindow, state);
 
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
     p = Gua_Expression(globalNameSpace, p, &object, &status, error);
@@ -1200,13 +1177,13 @@ void Glut_VisibilityFunc(int state)
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -1214,10 +1191,10 @@ void Glut_VisibilityFunc(int state)
  *     C
  *
  * Function:
- *     Gua_Status Glut_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Glut_GlutAddMenuEntryFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     GlutAddMenuEntry function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -1230,2647 +1207,22 @@ void Glut_VisibilityFunc(int state)
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Glut_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Glut_GlutAddMenuEntryFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Integer arg1i;
     Gua_Integer arg2i;
-    Gua_Integer arg3i;
-    Gua_Integer arg4i;
-    Gua_Integer arg5i;
-    Gua_Real arg1d;
-    Gua_Real arg2d;
-    Gua_Real arg3d;
-    Gua_Real arg4d;
-    Gua_Integer currentWindow;
-    Gua_String expression;
-    Gua_String p;
-    Gua_Status status;
-    Gua_String errMessage;
     
     Gua_ClearPObject(object);
     
-    arg1i = 0;
     arg2i = 0;
-    arg3i = 0;
-    arg4i = 0;
-    arg5i = 0;
-    
-    arg1d = 0.0;
-    arg2d = 0.0;
-    arg3d = 0.0;
-    arg4d = 0.0;
     
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-
-        return GUA_ERROR;
-    }
-
-    if (strcmp(Gua_ObjectToString(argv[0]), "glutAddMenuEntry") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glutAddMenuEntry(Gua_ObjectToString(argv[1]), arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutAddSubMenu") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glutAddSubMenu(Gua_ObjectToString(argv[1]), arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutAttachMenu") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutAttachMenu(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutBitmapCharacter") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_8_BY_13") == 0) {
-            glutBitmapCharacter(GLUT_BITMAP_8_BY_13, Gua_ObjectToString(argv[2])[0]);
-        } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_9_BY_15") == 0) {
-            glutBitmapCharacter(GLUT_BITMAP_9_BY_15, Gua_ObjectToString(argv[2])[0]);
-        } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_HELVETICA_10") == 0) {
-            glutBitmapCharacter(GLUT_BITMAP_HELVETICA_10, Gua_ObjectToString(argv[2])[0]);
-        } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_HELVETICA_12") == 0) {
-            glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, Gua_ObjectToString(argv[2])[0]);
-        } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_HELVETICA_18") == 0) {
-            glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, Gua_ObjectToString(argv[2])[0]);
-        } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_TIMES_ROMAN_10") == 0) {
-            glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_10, Gua_ObjectToString(argv[2])[0]);
-        } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_TIMES_ROMAN_24") == 0) {
-            glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_24, Gua_ObjectToString(argv[2])[0]);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutBitmapLength") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutBitmapWidth") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_MONO_ROMAN") == 0) {
-            Gua_IntegerToPObject(object, glutBitmapWidth(GLUT_STROKE_MONO_ROMAN, Gua_ObjectToString(argv[2])[0]));
-        } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_ROMAN") == 0) {
-            Gua_IntegerToPObject(object, glutBitmapWidth(GLUT_STROKE_ROMAN, Gua_ObjectToString(argv[2])[0]));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutButtonBoxFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_BUTTONBOXFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutButtonBoxFunc(Glut_ButtonBoxFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutChangeToMenuEntry") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-		if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        
-        glutChangeToMenuEntry(arg1i, Gua_ObjectToString(argv[2]), arg3i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutChangeToSubMenu") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-		if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        
-        glutChangeToSubMenu(arg1i, Gua_ObjectToString(argv[2]), arg3i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutCopyColormap") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutCopyColormap(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutCreateMenu") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_CREATEMENU[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Gua_IntegerToPObject(object, glutCreateMenu(Glut_CreateMenu));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutCreateSubWindow") == 0) {
-        if (argc != 6) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-            arg5i = Gua_ObjectToInteger(argv[5]);
-        } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
-            arg5i = roundl(Gua_ObjectToReal(argv[5]));            
-        }
-        
-        Gua_IntegerToPObject(object, glutCreateSubWindow(arg1i, arg2i, arg3i, arg4i, arg5i));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutCreateWindow") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, glutCreateWindow(Gua_ObjectToString(argv[1])));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutDestroyMenu") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutDestroyMenu(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutDestroyWindow") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutDestroyWindow(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutDetachMenu") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutDetachMenu(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutDeviceGet") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));           
-        }
-        
-        Gua_IntegerToPObject(object, glutDeviceGet(arg1i));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutDialsFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_DIALSFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutDialsFunc(Glut_DialsFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutDisplayFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_DISPLAYFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutDisplayFunc(Glut_DisplayFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutEnterGameMode") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutEntryFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_ENTRYFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutEntryFunc(Glut_EntryFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutEstablishOverlay") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutEstablishOverlay();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutExtensionSupported") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, glutExtensionSupported(Gua_ObjectToString(argv[1])));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutForceJoystickFunc") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutFullScreen") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutFullScreen();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutGameModeGet") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutGameModeString") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutGet") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));           
-        }
-        
-        Gua_IntegerToPObject(object, glutGet(arg1i));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutGetColor") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));           
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));           
-        }
-        
-        Gua_RealToPObject(object, glutGetColor(arg1i, arg2i));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutGetMenu") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, glutGetMenu());
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutGetModifiers") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, glutGetModifiers());
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutGetWindow") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, glutGetWindow());
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutHideOverlay") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutHideOverlay();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutHideWindow") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutHideWindow();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutIconifyWindow") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutIconifyWindow();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutIdleFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_IDLEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutIdleFunc(Glut_IdleFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutIgnoreKeyRepeat") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutInitDisplayMode") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutInitDisplayMode(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutInitDisplayString") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutInitWindowPosition") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glutInitWindowPosition(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutInitWindowSize") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glutInitWindowSize(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutJoystickFunc") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutKeyboardFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_KEYBOARDFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutKeyboardFunc(Glut_KeyboardFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutKeyboardUpFunc") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutLayerGet") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));           
-        }
-        
-        Gua_IntegerToPObject(object, glutLayerGet(arg1i));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutLeaveGameMode") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutMainLoop") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutMainLoop();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutMenuStateFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_MENUSTATEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutMenuStateFunc(Glut_MenuStateFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutMenuStatusFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_MENUSTATUSFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutMenuStatusFunc(Glut_MenuStatusFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutMotionFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_MOTIONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutMotionFunc(Glut_MotionFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutMouseFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_MOUSEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutMouseFunc(Glut_MouseFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutOverlayDisplayFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_OVERLAYDISPLAYFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutOverlayDisplayFunc(Glut_OverlayDisplayFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutPassiveMotionFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_PASSIVEMOTIONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutPassiveMotionFunc(Glut_PassiveMotionFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutPopWindow") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutPopWindow();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutPositionWindow") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glutPositionWindow(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutPostOverlayRedisplay") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutPostOverlayRedisplay();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutPostRedisplay") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutPostRedisplay();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutPostWindowOverlayRedisplay") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutPostWindowRedisplay") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutPushWindow") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutPushWindow();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutRemoveMenuItem") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutRemoveMenuItem(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutRemoveOverlay") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutRemoveOverlay();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutReportErrors") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutReshapeFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_RESHAPEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutReshapeFunc(Glut_ReshapeFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutReshapeWindow") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = roundl(Gua_ObjectToReal(argv[2]));            
-        }
-        
-        glutReshapeWindow(arg1i, arg2i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSetColor") == 0) {
-        if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));           
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2d = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2d = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3d = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3d = Gua_ObjectToReal(argv[3]);            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4d = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4d = Gua_ObjectToReal(argv[4]);            
-        }
-        
-        glutSetColor(arg1i, arg2d, arg3d, arg4d);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSetCursor") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutSetCursor(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSetIconTitle") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutSetIconTitle(Gua_ObjectToString(argv[1]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSetKeyRepeat") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSetMenu") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutSetMenu(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSetupVideoResizing") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSetWindow") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutSetWindow(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSetWindowTitle") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutSetWindowTitle(Gua_ObjectToString(argv[1]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutShowOverlay") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutShowOverlay();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutShowWindow") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutShowWindow();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSolidCone") == 0) {
-		if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2d = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2d = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        
-        glutSolidCone(arg1d, arg2d, arg3i, arg4i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSolidCube") == 0) {
-		if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        
-        glutSolidCube(arg1d);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSolidDodecahedron") == 0) {
-		if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutSolidDodecahedron();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSolidIcosahedron") == 0) {
-		if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutSolidIcosahedron();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSolidOctahedron") == 0) {
-		if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        glutSolidOctahedron();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSolidSphere") == 0) {
-		if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        
-        glutSolidSphere(arg1d, arg2i, arg3i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSolidTeapot") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        
-        glutSolidTeapot(arg1d);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSolidTetrahedron") == 0) {
-		if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutSolidTetrahedron();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSolidTorus") == 0) {
-		if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2d = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2d = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-
-        glutSolidTorus(arg1d, arg2d, arg3i, arg4i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSpaceballButtonFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_SPACEBALLBUTTONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutSpaceballButtonFunc(Glut_SpaceballButtonFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSpaceballMotionFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_SPACEBALLMOTIONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutSpaceballMotionFunc(Glut_SpaceballMotionFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSpaceballRotateFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_SPACEBALLROTATEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutSpaceballRotateFunc(Glut_SpaceballRotateFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSpecialFunc") == 0) {
-		if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_SPECIALFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutSpecialFunc(Glut_SpecialFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSpecialUpFunc") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutStopVideoResizing") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutStrokeCharacter") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_MONO_ROMAN") == 0) {
-            glutStrokeCharacter(GLUT_STROKE_MONO_ROMAN, Gua_ObjectToString(argv[2])[0]);
-        } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_ROMAN") == 0) {
-            glutStrokeCharacter(GLUT_STROKE_ROMAN, Gua_ObjectToString(argv[2])[0]);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutStrokeLength") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutStrokeWidth") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_MONO_ROMAN") == 0) {
-            Gua_IntegerToPObject(object, glutStrokeWidth(GLUT_STROKE_MONO_ROMAN, Gua_ObjectToString(argv[2])[0]));
-        } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_ROMAN") == 0) {
-            Gua_IntegerToPObject(object, glutStrokeWidth(GLUT_STROKE_ROMAN, Gua_ObjectToString(argv[2])[0]));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutSwapBuffers") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutSwapBuffers();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutTabletButtonFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_TABLETBUTTONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutTabletButtonFunc(Glut_TabletButtonFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutTabletMotionFunc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_TABLETMOTIONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutTabletMotionFunc(Glut_TabletMotionFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutTimerFunc") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-		if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_TIMERFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutTimerFunc(arg1i, Glut_TimerFunc, arg3i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutUseLayer") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1i = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1i = roundl(Gua_ObjectToReal(argv[1]));            
-        }
-        
-        glutUseLayer(arg1i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutVideoPan") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutVideoResize") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutVideoResizeGet") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutVisibilityFunc") == 0) {
-		if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        currentWindow = glutGetWindow();
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLUT_VISIBILITYFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        glutVisibilityFunc(Glut_VisibilityFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWarpPointer") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWindowStatusFunc") == 0) {
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWireCone") == 0) {
-		if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2d = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2d = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-        
-        glutWireCone(arg1d, arg2d, arg3i, arg4i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWireCube") == 0) {
-		if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        
-        glutWireCube(arg1d);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWireDodecahedron") == 0) {
-		if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutWireDodecahedron();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWireIcosahedron") == 0) {
-		if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutWireIcosahedron();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWireOctahedron") == 0) {
-		if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        glutWireOctahedron();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWireSphere") == 0) {
-		if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2i = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2i = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        
-        glutWireSphere(arg1d, arg2i, arg3i);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWireTeapot") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        
-        glutWireTeapot(arg1d);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWireTetrahedron") == 0) {
-		if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        glutWireTetrahedron();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glutWireTorus") == 0) {
-		if (argc != 5) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-		if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            arg1d = Gua_ObjectToInteger(argv[1]);
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            arg1d = Gua_ObjectToReal(argv[1]);            
-        }
-        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-            arg2d = Gua_ObjectToInteger(argv[2]);
-        } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
-            arg2d = Gua_ObjectToReal(argv[2]);            
-        }
-        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-            arg3i = Gua_ObjectToInteger(argv[3]);
-        } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-            arg3i = roundl(Gua_ObjectToReal(argv[3]));            
-        }
-        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-            arg4i = Gua_ObjectToInteger(argv[4]);
-        } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
-            arg4i = roundl(Gua_ObjectToReal(argv[4]));            
-        }
-
-        glutWireTorus(arg1d, arg2d, arg3i, arg4i);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-
+    
+    glutAddMenuEntry(Gua_ObjectToString(argv[1]), arg2i);
+    
     return GUA_OK;
 }
 
@@ -3879,822 +1231,4492 @@ Gua_Status Glut_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv,
  *     C
  *
  * Function:
- *     Gua_Status Glut_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *     Gua_Status Glut_GlutAddSubMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Install the extension functions.
+ *     GlutAddSubMenu function wrapper.
  *
  * Arguments:
- *     nspace,    a pointer to a structure containing the variable and function namespace;
- *     argc,      the number of command line arguments;
- *     argv,      the command line arguments;
- *     env,       a pointer to the environment variables;
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
  *     error,     a pointer to the error message.
  *
  * Results:
- *     Install the extension functions.
+ *     The return object of the wrapped function.
  */
-Gua_Status Glut_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+Gua_Status Glut_GlutAddSubMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Function function;
-    Gua_Object object;
-    Gua_String errMessage;
+    Gua_Integer arg2i;
     
-    globalNameSpace = nspace;
+    Gua_ClearPObject(object);
     
-    /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutAddMenuEntry", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutAddMenuEntry");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutAddSubMenu", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutAddSubMenu");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutAttachMenu", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutAttachMenu");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutAddSubMenu(Gua_ObjectToString(argv[1]), arg2i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutAttachMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutAttachMenu function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutAttachMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutBitmapCharacter", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutBitmapCharacter");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutAttachMenu(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutBitmapCharacterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutBitmapCharacter function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutBitmapCharacterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_8_BY_13") == 0) {
+        glutBitmapCharacter(GLUT_BITMAP_8_BY_13, Gua_ObjectToString(argv[2])[0]);
+    } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_9_BY_15") == 0) {
+        glutBitmapCharacter(GLUT_BITMAP_9_BY_15, Gua_ObjectToString(argv[2])[0]);
+    } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_HELVETICA_10") == 0) {
+        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_10, Gua_ObjectToString(argv[2])[0]);
+    } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_HELVETICA_12") == 0) {
+        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, Gua_ObjectToString(argv[2])[0]);
+    } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_HELVETICA_18") == 0) {
+        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, Gua_ObjectToString(argv[2])[0]);
+    } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_TIMES_ROMAN_10") == 0) {
+        glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_10, Gua_ObjectToString(argv[2])[0]);
+    } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_BITMAP_TIMES_ROMAN_24") == 0) {
+        glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_24, Gua_ObjectToString(argv[2])[0]);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutBitmapLength", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutBitmapLength");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutBitmapLengthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutBitmapLength function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutBitmapLengthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutBitmapWidthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutBitmapWidth function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutBitmapWidthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_MONO_ROMAN") == 0) {
+        Gua_IntegerToPObject(object, glutBitmapWidth(GLUT_STROKE_MONO_ROMAN, Gua_ObjectToString(argv[2])[0]));
+    } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_ROMAN") == 0) {
+        Gua_IntegerToPObject(object, glutBitmapWidth(GLUT_STROKE_ROMAN, Gua_ObjectToString(argv[2])[0]));
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutBitmapWidth", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutBitmapWidth");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutButtonBoxFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutButtonBoxFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutButtonBoxFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_BUTTONBOXFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutButtonBoxFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutButtonBoxFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutButtonBoxFunc(Glut_ButtonBoxFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutChangeToMenuEntryFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutChangeToMenuEntry function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutChangeToMenuEntryFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Integer arg3i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg3i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutChangeToMenuEntry", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutChangeToMenuEntry");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutChangeToSubMenu", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutChangeToSubMenu");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutChangeToMenuEntry(arg1i, Gua_ObjectToString(argv[2]), arg3i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutChangeToSubMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutChangeToSubMenu function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutChangeToSubMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Integer arg3i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg3i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutCopyColormap", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutCopyColormap");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutCreateMenu", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutCreateMenu");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutChangeToSubMenu(arg1i, Gua_ObjectToString(argv[2]), arg3i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutCopyColormapFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutCopyColormap function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutCopyColormapFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutCreateSubWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutCreateSubWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutCopyColormap(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutCreateMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutCreateMenu function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutCreateMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_CREATEMENU[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutCreateWindow", &function) != GUA_OK) {
+    
+    Gua_Free(expression);
+    
+    Gua_IntegerToPObject(object, glutCreateMenu(Glut_CreateMenu));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutCreateSubWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutCreateSubWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutCreateSubWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Integer arg2i;
+    Gua_Integer arg3i;
+    Gua_Integer arg4i;
+    Gua_Integer arg5i;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    arg3i = 0;
+    arg4i = 0;
+    arg5i = 0;
+    
+    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutCreateWindow");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutDestroyMenu", &function) != GUA_OK) {
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutDestroyMenu");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutDestroyWindow", &function) != GUA_OK) {
+    if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutDestroyWindow");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutDetachMenu", &function) != GUA_OK) {
+    if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutDetachMenu");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutDeviceGet", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutDeviceGet");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
+    }
+    if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+        arg5i = Gua_ObjectToInteger(argv[5]);
+    } else if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL) {
+        arg5i = roundl(Gua_ObjectToReal(argv[5]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutDialsFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutDialsFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_IntegerToPObject(object, glutCreateSubWindow(arg1i, arg2i, arg3i, arg4i, arg5i));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutCreateWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutCreateWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutCreateWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    Gua_IntegerToPObject(object, glutCreateWindow(Gua_ObjectToString(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutDestroyMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutDestroyMenu function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutDestroyMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutDisplayFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutDisplayFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutDestroyMenu(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutDestroyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutDestroyWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutDestroyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutEnterGameMode", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutEnterGameMode");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutDestroyWindow(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutDetachMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutDetachMenu function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutDetachMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutEntryFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutEntryFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutEstablishOverlay", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutEstablishOverlay");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutExtensionSupported", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutExtensionSupported");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutForceJoystickFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutForceJoystickFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutFullScreen", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutFullScreen");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutGameModeGet", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutGameModeGet");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutGameModeString", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutGameModeString");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutGet", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutGet");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutGetColor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutGetColor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutGetMenu", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutGetMenu");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutGetModifiers", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutGetModifiers");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutGetWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutGetWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutHideOverlay", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutHideOverlay");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutHideWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutHideWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutIconifyWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutIconifyWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutIdleFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutIdleFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutIgnoreKeyRepeat", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutIgnoreKeyRepeat");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutInitDisplayMode", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutInitDisplayMode");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutInitDisplayString", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutInitDisplayString");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutDetachMenu(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutDeviceGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutDeviceGet function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutDeviceGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));           
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutInitWindowPosition", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutInitWindowPosition");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_IntegerToPObject(object, glutDeviceGet(arg1i));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutDialsFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutDialsFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutDialsFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_DIALSFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutInitWindowSize", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutInitWindowSize");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutDialsFunc(Glut_DialsFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutDisplayFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutDisplayFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutDisplayFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_DISPLAYFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutJoystickFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutJoystickFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutDisplayFunc(Glut_DisplayFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutEnterGameModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutEnterGameMode function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutEnterGameModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutEntryFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutEntryFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutEntryFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_ENTRYFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutKeyboardFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutKeyboardFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutKeyboardUpFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutKeyboardUpFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutLayerGet", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutLayerGet");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutLeaveGameMode", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutLeaveGameMode");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutMainLoop", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutMainLoop");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutMenuStateFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutMenuStateFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutMenuStatusFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutMenuStatusFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutMotionFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutMotionFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutEntryFunc(Glut_EntryFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutEstablishOverlayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutEstablishOverlay function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutEstablishOverlayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutEstablishOverlay();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutExtensionSupportedFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutExtensionSupported function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutExtensionSupportedFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    Gua_IntegerToPObject(object, glutExtensionSupported(Gua_ObjectToString(argv[1])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutForceJoystickFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutForceJoystickFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutForceJoystickFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutFullScreenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutFullScreen function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutFullScreenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutFullScreen();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutGameModeGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutGameModeGet function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutGameModeGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutGameModeStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutGameModeString function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutGameModeStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutGet function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));           
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutMouseFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutMouseFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_IntegerToPObject(object, glutGet(arg1i));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutGetColorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutGetColor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutGetColorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Integer arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));           
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutOverlayDisplayFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutOverlayDisplayFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));           
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutPassiveMotionFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutPassiveMotionFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutPopWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutPopWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutPositionWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutPositionWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutPostOverlayRedisplay", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutPostOverlayRedisplay");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutPostRedisplay", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutPostRedisplay");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_RealToPObject(object, glutGetColor(arg1i, arg2i));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutGetMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutGetMenu function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutGetMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    Gua_IntegerToPObject(object, glutGetMenu());
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutGetModifiersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutGetModifiers function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutGetModifiersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    Gua_IntegerToPObject(object, glutGetModifiers());
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutGetWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutGetWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutGetWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    Gua_IntegerToPObject(object, glutGetWindow());
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutHideOverlayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutHideOverlay function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutHideOverlayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutHideOverlay();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutHideWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutHideWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutHideWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutHideWindow();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutIconifyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutIconifyWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutIconifyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutIconifyWindow();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutIdleFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutIdleFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutIdleFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_IDLEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutPostWindowOverlayRedisplay", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutPostWindowOverlayRedisplay");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutIdleFunc(Glut_IdleFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutIgnoreKeyRepeatFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutIgnoreKeyRepeat function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutIgnoreKeyRepeatFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutInitDisplayModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutInitDisplayMode function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutInitDisplayModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutPostWindowRedisplay", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutPostWindowRedisplay");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutInitDisplayMode(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutInitDisplayStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutInitDisplayString function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutInitDisplayStringFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutInitWindowPositionFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutInitWindowPosition function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutInitWindowPositionFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Integer arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutPushWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutPushWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutRemoveMenuItem", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutRemoveMenuItem");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutInitWindowPosition(arg1i, arg2i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutInitWindowSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutInitWindowSize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutInitWindowSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Integer arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutRemoveOverlay", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutRemoveOverlay");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutReportErrors", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutReportErrors");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutInitWindowSize(arg1i, arg2i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutJoystickFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutJoystickFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutJoystickFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutKeyboardFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutKeyboardFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutKeyboardFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_KEYBOARDFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutReshapeFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutReshapeFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutKeyboardFunc(Glut_KeyboardFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutKeyboardUpFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutKeyboardUpFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutKeyboardUpFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutLayerGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutLayerGet function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutLayerGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));           
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutReshapeWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutReshapeWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_IntegerToPObject(object, glutLayerGet(arg1i));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutLeaveGameModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutLeaveGameMode function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutLeaveGameModeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutMainLoopFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutMainLoop function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutMainLoopFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutMainLoop();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutMenuStateFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutMenuStateFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutMenuStateFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_MENUSTATEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSetColor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSetColor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutMenuStateFunc(Glut_MenuStateFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutMenuStatusFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutMenuStatusFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutMenuStatusFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_MENUSTATUSFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSetCursor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSetCursor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutMenuStatusFunc(Glut_MenuStatusFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutMotionFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_MOTIONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSetIconTitle", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSetIconTitle");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutMotionFunc(Glut_MotionFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutMouseFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutMouseFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutMouseFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_MOUSEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSetKeyRepeat", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSetKeyRepeat");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutMouseFunc(Glut_MouseFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutOverlayDisplayFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutOverlayDisplayFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutOverlayDisplayFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_OVERLAYDISPLAYFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSetMenu", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSetMenu");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutOverlayDisplayFunc(Glut_OverlayDisplayFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutPassiveMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutPassiveMotionFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutPassiveMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_PASSIVEMOTIONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSetupVideoResizing", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSetupVideoResizing");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutPassiveMotionFunc(Glut_PassiveMotionFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutPopWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutPopWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutPopWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutPopWindow();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutPositionWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutPositionWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutPositionWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Integer arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSetWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSetWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSetWindowTitle", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSetWindowTitle");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutPositionWindow(arg1i, arg2i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutPostOverlayRedisplayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutPostOverlayRedisplay function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutPostOverlayRedisplayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutPostOverlayRedisplay();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutPostRedisplayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutPostRedisplay function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutPostRedisplayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutPostRedisplay();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutPostWindowOverlayRedisplayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutPostWindowOverlayRedisplay function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutPostWindowOverlayRedisplayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutPostWindowRedisplayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutPostWindowRedisplay function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutPostWindowRedisplayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutPushWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutPushWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutPushWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutPushWindow();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutRemoveMenuItemFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutRemoveMenuItem function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutRemoveMenuItemFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutShowOverlay", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutShowOverlay");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutRemoveMenuItem(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutRemoveOverlayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutRemoveOverlay function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutRemoveOverlayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutRemoveOverlay();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutReportErrorsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutReportErrors function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutReportErrorsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutReshapeFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutReshapeFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutReshapeFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_RESHAPEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutShowWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutShowWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutReshapeFunc(Glut_ReshapeFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutReshapeWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutReshapeWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutReshapeWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Integer arg2i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg2i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSolidCone", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSolidCone");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = roundl(Gua_ObjectToReal(argv[2]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSolidCube", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSolidCube");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutReshapeWindow(arg1i, arg2i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSetColorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSetColor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSetColorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Real arg2d;
+    Gua_Real arg3d;
+    Gua_Real arg4d;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    arg2d = 0.0;
+    arg3d = 0.0;
+    arg4d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));           
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2d = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2d = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3d = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3d = Gua_ObjectToReal(argv[3]);            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4d = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4d = Gua_ObjectToReal(argv[4]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSolidDodecahedron", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSolidDodecahedron");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutSetColor(arg1i, arg2d, arg3d, arg4d);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSetCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSetCursor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSetCursorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSolidIcosahedron", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSolidIcosahedron");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutSetCursor(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSetIconTitleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSetIconTitle function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSetIconTitleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutSetIconTitle(Gua_ObjectToString(argv[1]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSetKeyRepeatFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSetKeyRepeat function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSetKeyRepeatFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSetMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSetMenu function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSetMenuFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSolidOctahedron", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSolidOctahedron");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutSetMenu(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSetupVideoResizingFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSetupVideoResizing function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSetupVideoResizingFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSetWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSetWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSetWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSolidSphere", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSolidSphere");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutSetWindow(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSetWindowTitleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSetWindowTitle function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSetWindowTitleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutSetWindowTitle(Gua_ObjectToString(argv[1]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutShowOverlayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutShowOverlay function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutShowOverlayFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutShowOverlay();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutShowWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutShowWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutShowWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutShowWindow();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSolidConeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSolidCone function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSolidConeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg3i;
+    Gua_Integer arg4i;
+    Gua_Real arg1d;
+    Gua_Real arg2d;
+    
+    Gua_ClearPObject(object);
+    
+    arg3i = 0;
+    arg4i = 0;
+    
+    arg1d = 0.0;
+    arg2d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2d = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2d = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSolidTeapot", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSolidTeapot");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutSolidCone(arg1d, arg2d, arg3i, arg4i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSolidCubeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSolidCube function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSolidCubeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real arg1d;
+    
+    Gua_ClearPObject(object);
+    
+    arg1d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSolidTetrahedron", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSolidTetrahedron");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutSolidCube(arg1d);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSolidDodecahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSolidDodecahedron function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSolidDodecahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutSolidDodecahedron();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSolidIcosahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSolidIcosahedron function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSolidIcosahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutSolidIcosahedron();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSolidOctahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSolidOctahedron function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSolidOctahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutSolidOctahedron();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSolidSphereFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSolidSphere function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSolidSphereFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg2i;
+    Gua_Integer arg3i;
+    Gua_Real arg1d;
+    
+    Gua_ClearPObject(object);
+    
+    arg2i = 0;
+    arg3i = 0;
+    
+    arg1d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSolidTorus", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSolidTorus");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = Gua_ObjectToReal(argv[2]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSpaceballButtonFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSpaceballButtonFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSpaceballMotionFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSpaceballMotionFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutSolidSphere(arg1d, arg2i, arg3i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSolidTeapotFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSolidTeapot function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSolidTeapotFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real arg1d;
+    
+    Gua_ClearPObject(object);
+    
+    arg1d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSpaceballRotateFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSpaceballRotateFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutSolidTeapot(arg1d);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSolidTetrahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSolidTetrahedron function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSolidTetrahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutSolidTetrahedron();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSolidTorusFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSolidTorus function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSolidTorusFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg3i;
+    Gua_Integer arg4i;
+    Gua_Real arg1d;
+    Gua_Real arg2d;
+    
+    Gua_ClearPObject(object);
+    
+    arg3i = 0;
+    arg4i = 0;
+    
+    arg1d = 0.0;
+    arg2d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSpecialFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSpecialFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2d = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2d = Gua_ObjectToReal(argv[2]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSpecialUpFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSpecialUpFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutStopVideoResizing", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutStopVideoResizing");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutStrokeCharacter", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutStrokeCharacter");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+
+    glutSolidTorus(arg1d, arg2d, arg3i, arg4i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSpaceballButtonFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSpaceballButtonFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSpaceballButtonFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_SPACEBALLBUTTONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutStrokeLength", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutStrokeLength");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutSpaceballButtonFunc(Glut_SpaceballButtonFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSpaceballMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSpaceballMotionFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSpaceballMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_SPACEBALLMOTIONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutStrokeWidth", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutStrokeWidth");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutSpaceballMotionFunc(Glut_SpaceballMotionFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSpaceballRotateFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSpaceballRotateFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSpaceballRotateFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_SPACEBALLROTATEFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutSwapBuffers", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutSwapBuffers");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutSpaceballRotateFunc(Glut_SpaceballRotateFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSpecialFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSpecialFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSpecialFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_SPECIALFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutTabletButtonFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutTabletButtonFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutSpecialFunc(Glut_SpecialFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSpecialUpFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSpecialUpFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSpecialUpFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutStopVideoResizingFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutStopVideoResizing function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutStopVideoResizingFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutStrokeCharacterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutStrokeCharacter function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutStrokeCharacterFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_MONO_ROMAN") == 0) {
+        glutStrokeCharacter(GLUT_STROKE_MONO_ROMAN, Gua_ObjectToString(argv[2])[0]);
+    } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_ROMAN") == 0) {
+        glutStrokeCharacter(GLUT_STROKE_ROMAN, Gua_ObjectToString(argv[2])[0]);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutTabletMotionFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutTabletMotionFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutStrokeLengthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutStrokeLength function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutStrokeLengthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutStrokeWidthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutStrokeWidth function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutStrokeWidthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_MONO_ROMAN") == 0) {
+        Gua_IntegerToPObject(object, glutStrokeWidth(GLUT_STROKE_MONO_ROMAN, Gua_ObjectToString(argv[2])[0]));
+    } else if (strcmp(Gua_ObjectToString(argv[1]), "GLUT_STROKE_ROMAN") == 0) {
+        Gua_IntegerToPObject(object, glutStrokeWidth(GLUT_STROKE_ROMAN, Gua_ObjectToString(argv[2])[0]));
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutTimerFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutTimerFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutSwapBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutSwapBuffers function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutSwapBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutSwapBuffers();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutTabletButtonFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutTabletButtonFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutTabletButtonFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_TABLETBUTTONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutUseLayer", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutUseLayer");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutTabletButtonFunc(Glut_TabletButtonFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutTabletMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutTabletMotionFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutTabletMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_TABLETMOTIONFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutVideoPan", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutVideoPan");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutTabletMotionFunc(Glut_TabletMotionFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutTimerFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutTimerFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutTimerFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    Gua_Integer arg3i;
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    arg3i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutVideoResize", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutVideoResize");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutVideoResizeGet", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutVideoResizeGet");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_TIMERFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutVisibilityFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutVisibilityFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutTimerFunc(arg1i, Glut_TimerFunc, arg3i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutUseLayerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutUseLayer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutUseLayerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg1i;
+    
+    Gua_ClearPObject(object);
+    
+    arg1i = 0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1i = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1i = roundl(Gua_ObjectToReal(argv[1]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWarpPointer", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWarpPointer");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutUseLayer(arg1i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutVideoPanFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutVideoPan function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutVideoPanFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutVideoResizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutVideoResize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutVideoResizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutVideoResizeGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutVideoResizeGet function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutVideoResizeGetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutVisibilityFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutVisibilityFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutVisibilityFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer currentWindow;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    
+    Gua_ClearPObject(object);
+    
+    currentWindow = glutGetWindow();
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLUT_VISIBILITYFUNC[%ld] = \"%s\";", currentWindow, Gua_ObjectToString(argv[1]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWindowStatusFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWindowStatusFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    Gua_Free(expression);
+    
+    glutVisibilityFunc(Glut_VisibilityFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWarpPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWarpPointer function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWarpPointerFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWindowStatusFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWindowStatusFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWindowStatusFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWireConeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWireCone function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWireConeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg3i;
+    Gua_Integer arg4i;
+    Gua_Real arg1d;
+    Gua_Real arg2d;
+    
+    Gua_ClearPObject(object);
+    
+    arg3i = 0;
+    arg4i = 0;
+    
+    arg1d = 0.0;
+    arg2d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
+    }
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2d = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2d = Gua_ObjectToReal(argv[2]);            
+    }
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
+    }
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWireCone", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWireCone");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutWireCone(arg1d, arg2d, arg3i, arg4i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWireCubeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWireCube function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWireCubeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real arg1d;
+    
+    Gua_ClearPObject(object);
+    
+    arg1d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWireCube", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWireCube");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutWireCube(arg1d);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWireDodecahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWireDodecahedron function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWireDodecahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutWireDodecahedron();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWireIcosahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWireIcosahedron function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWireIcosahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutWireIcosahedron();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWireOctahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWireOctahedron function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWireOctahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutWireOctahedron();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWireSphereFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWireSphere function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWireSphereFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg2i;
+    Gua_Integer arg3i;
+    Gua_Real arg1d;
+    
+    Gua_ClearPObject(object);
+    
+    arg2i = 0;
+    arg3i = 0;
+    
+    arg1d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWireDodecahedron", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWireDodecahedron");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2i = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2i = Gua_ObjectToReal(argv[2]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWireIcosahedron", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWireIcosahedron");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWireOctahedron", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWireOctahedron");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutWireSphere(arg1d, arg2i, arg3i);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWireTeapotFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWireTeapot function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWireTeapotFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real arg1d;
+    
+    Gua_ClearPObject(object);
+    
+    arg1d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWireSphere", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWireSphere");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    
+    glutWireTeapot(arg1d);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWireTetrahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWireTetrahedron function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWireTetrahedronFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    glutWireTetrahedron();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_GlutWireTorusFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlutWireTorus function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glut_GlutWireTorusFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer arg3i;
+    Gua_Integer arg4i;
+    Gua_Real arg1d;
+    Gua_Real arg2d;
+    
+    Gua_ClearPObject(object);
+    
+    arg3i = 0;
+    arg4i = 0;
+    
+    arg1d = 0.0;
+    arg2d = 0.0;
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        arg1d = Gua_ObjectToInteger(argv[1]);
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        arg1d = Gua_ObjectToReal(argv[1]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWireTeapot", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWireTeapot");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+        arg2d = Gua_ObjectToInteger(argv[2]);
+    } else if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL) {
+        arg2d = Gua_ObjectToReal(argv[2]);            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWireTetrahedron", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWireTetrahedron");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+        arg3i = Gua_ObjectToInteger(argv[3]);
+    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+        arg3i = roundl(Gua_ObjectToReal(argv[3]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glutWireTorus", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glutWireTorus");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
+    if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+        arg4i = Gua_ObjectToInteger(argv[4]);
+    } else if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL) {
+        arg4i = roundl(Gua_ObjectToReal(argv[4]));            
     }
-    Gua_LinkCFunctionToFunction(function, Glut_FunctionWrapper);
+
+    glutWireTorus(arg1d, arg2d, arg3i, arg4i);
+    
+    return GUA_OK;
+}
+
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Glut_Functions[] = {
+    {"glutAddMenuEntry", Glut_GlutAddMenuEntryFunctionWrapper, 3, "sn"},
+    {"glutAddSubMenu", Glut_GlutAddSubMenuFunctionWrapper, 3, "sn"},
+    {"glutAttachMenu", Glut_GlutAttachMenuFunctionWrapper, 2, "n"},
+    {"glutBitmapCharacter", Glut_GlutBitmapCharacterFunctionWrapper, 3, "ss"},
+    {"glutBitmapLength", Glut_GlutBitmapLengthFunctionWrapper, 0, NULL},
+    {"glutBitmapWidth", Glut_GlutBitmapWidthFunctionWrapper, 3, "ss"},
+    {"glutButtonBoxFunc", Glut_GlutButtonBoxFuncFunctionWrapper, 2, "s"},
+    {"glutChangeToMenuEntry", Glut_GlutChangeToMenuEntryFunctionWrapper, 4, "nsn"},
+    {"glutChangeToSubMenu", Glut_GlutChangeToSubMenuFunctionWrapper, 4, "nsn"},
+    {"glutCopyColormap", Glut_GlutCopyColormapFunctionWrapper, 2, "n"},
+    {"glutCreateMenu", Glut_GlutCreateMenuFunctionWrapper, 2, "s"},
+    {"glutCreateSubWindow", Glut_GlutCreateSubWindowFunctionWrapper, 6, "n"},
+    {"glutCreateWindow", Glut_GlutCreateWindowFunctionWrapper, 2, "s"},
+    {"glutDestroyMenu", Glut_GlutDestroyMenuFunctionWrapper, 2, "n"},
+    {"glutDestroyWindow", Glut_GlutDestroyWindowFunctionWrapper, 2, "n"},
+    {"glutDetachMenu", Glut_GlutDetachMenuFunctionWrapper, 2, "n"},
+    {"glutDeviceGet", Glut_GlutDeviceGetFunctionWrapper, 2, "n"},
+    {"glutDialsFunc", Glut_GlutDialsFuncFunctionWrapper, 2, "s"},
+    {"glutDisplayFunc", Glut_GlutDisplayFuncFunctionWrapper, 2, "s"},
+    {"glutEnterGameMode", Glut_GlutEnterGameModeFunctionWrapper, 0, NULL},
+    {"glutEntryFunc", Glut_GlutEntryFuncFunctionWrapper, 2, "s"},
+    {"glutEstablishOverlay", Glut_GlutEstablishOverlayFunctionWrapper, 1, NULL},
+    {"glutExtensionSupported", Glut_GlutExtensionSupportedFunctionWrapper, 2, "s"},
+    {"glutForceJoystickFunc", Glut_GlutForceJoystickFuncFunctionWrapper, 0, NULL},
+    {"glutFullScreen", Glut_GlutFullScreenFunctionWrapper, 1, NULL},
+    {"glutGameModeGet", Glut_GlutGameModeGetFunctionWrapper, 0, NULL},
+    {"glutGameModeString", Glut_GlutGameModeStringFunctionWrapper, 0, NULL},
+    {"glutGet", Glut_GlutGetFunctionWrapper, 2, "n"},
+    {"glutGetColor", Glut_GlutGetColorFunctionWrapper, 3, "nn"},
+    {"glutGetMenu", Glut_GlutGetMenuFunctionWrapper, 1, NULL},
+    {"glutGetModifiers", Glut_GlutGetModifiersFunctionWrapper, 1, NULL},
+    {"glutGetWindow", Glut_GlutGetWindowFunctionWrapper, 1, NULL},
+    {"glutHideOverlay", Glut_GlutHideOverlayFunctionWrapper, 1, NULL},
+    {"glutHideWindow", Glut_GlutHideWindowFunctionWrapper, 1, NULL},
+    {"glutIconifyWindow", Glut_GlutIconifyWindowFunctionWrapper, 1, NULL},
+    {"glutIdleFunc", Glut_GlutIdleFuncFunctionWrapper, 2, "s"},
+    {"glutIgnoreKeyRepeat", Glut_GlutIgnoreKeyRepeatFunctionWrapper, 0, NULL},
+    {"glutInitDisplayMode", Glut_GlutInitDisplayModeFunctionWrapper, 2, "n"},
+    {"glutInitDisplayString", Glut_GlutInitDisplayStringFunctionWrapper, 0, NULL},
+    {"glutInitWindowPosition", Glut_GlutInitWindowPositionFunctionWrapper, 3, "nn"},
+    {"glutInitWindowSize", Glut_GlutInitWindowSizeFunctionWrapper, 3, "nn"},
+    {"glutJoystickFunc", Glut_GlutJoystickFuncFunctionWrapper, 0, NULL},
+    {"glutKeyboardFunc", Glut_GlutKeyboardFuncFunctionWrapper, 2, "s"},
+    {"glutKeyboardUpFunc", Glut_GlutKeyboardUpFuncFunctionWrapper, 0, NULL},
+    {"glutLayerGet", Glut_GlutLayerGetFunctionWrapper, 2, "n"},
+    {"glutLeaveGameMode", Glut_GlutLeaveGameModeFunctionWrapper, 0, NULL},
+    {"glutMainLoop", Glut_GlutMainLoopFunctionWrapper, 1, NULL},
+    {"glutMenuStateFunc", Glut_GlutMenuStateFuncFunctionWrapper, 2, "s"},
+    {"glutMenuStatusFunc", Glut_GlutMenuStatusFuncFunctionWrapper, 2, "s"},
+    {"glutMotionFunc", Glut_GlutMotionFuncFunctionWrapper, 2, "s"},
+    {"glutMouseFunc", Glut_GlutMouseFuncFunctionWrapper, 2, "s"},
+    {"glutOverlayDisplayFunc", Glut_GlutOverlayDisplayFuncFunctionWrapper, 2, "s"},
+    {"glutPassiveMotionFunc", Glut_GlutPassiveMotionFuncFunctionWrapper, 2, "s"},
+    {"glutPopWindow", Glut_GlutPopWindowFunctionWrapper, 1, NULL},
+    {"glutPositionWindow", Glut_GlutPositionWindowFunctionWrapper, 3, "nn"},
+    {"glutPostOverlayRedisplay", Glut_GlutPostOverlayRedisplayFunctionWrapper, 1, NULL},
+    {"glutPostRedisplay", Glut_GlutPostRedisplayFunctionWrapper, 1, NULL},
+    {"glutPostWindowOverlayRedisplay", Glut_GlutPostWindowOverlayRedisplayFunctionWrapper, 0, NULL},
+    {"glutPostWindowRedisplay", Glut_GlutPostWindowRedisplayFunctionWrapper, 0, NULL},
+    {"glutPushWindow", Glut_GlutPushWindowFunctionWrapper, 1, NULL},
+    {"glutRemoveMenuItem", Glut_GlutRemoveMenuItemFunctionWrapper, 2, "n"},
+    {"glutRemoveOverlay", Glut_GlutRemoveOverlayFunctionWrapper, 1, NULL},
+    {"glutReportErrors", Glut_GlutReportErrorsFunctionWrapper, 0, NULL},
+    {"glutReshapeFunc", Glut_GlutReshapeFuncFunctionWrapper, 2, "s"},
+    {"glutReshapeWindow", Glut_GlutReshapeWindowFunctionWrapper, 3, "nn"},
+    {"glutSetColor", Glut_GlutSetColorFunctionWrapper, 5, "nnnn"},
+    {"glutSetCursor", Glut_GlutSetCursorFunctionWrapper, 2, "n"},
+    {"glutSetIconTitle", Glut_GlutSetIconTitleFunctionWrapper, 2, "s"},
+    {"glutSetKeyRepeat", Glut_GlutSetKeyRepeatFunctionWrapper, 0, NULL},
+    {"glutSetMenu", Glut_GlutSetMenuFunctionWrapper, 2, "n"},
+    {"glutSetupVideoResizing", Glut_GlutSetupVideoResizingFunctionWrapper, 0, NULL},
+    {"glutSetWindow", Glut_GlutSetWindowFunctionWrapper, 2, "n"},
+    {"glutSetWindowTitle", Glut_GlutSetWindowTitleFunctionWrapper, 2, "s"},
+    {"glutShowOverlay", Glut_GlutShowOverlayFunctionWrapper, 1, NULL},
+    {"glutShowWindow", Glut_GlutShowWindowFunctionWrapper, 1, NULL},
+    {"glutSolidCone", Glut_GlutSolidConeFunctionWrapper, 5, "nnnn"},
+    {"glutSolidCube", Glut_GlutSolidCubeFunctionWrapper, 2, "n"},
+    {"glutSolidDodecahedron", Glut_GlutSolidDodecahedronFunctionWrapper, 1, NULL},
+    {"glutSolidIcosahedron", Glut_GlutSolidIcosahedronFunctionWrapper, 1, NULL},
+    {"glutSolidOctahedron", Glut_GlutSolidOctahedronFunctionWrapper, 1, NULL},
+    {"glutSolidSphere", Glut_GlutSolidSphereFunctionWrapper, 4, "nnn"},
+    {"glutSolidTeapot", Glut_GlutSolidTeapotFunctionWrapper, 2, "n"},
+    {"glutSolidTetrahedron", Glut_GlutSolidTetrahedronFunctionWrapper, 1, NULL},
+    {"glutSolidTorus", Glut_GlutSolidTorusFunctionWrapper, 5, "nnnn"},
+    {"glutSpaceballButtonFunc", Glut_GlutSpaceballButtonFuncFunctionWrapper, 2, "s"},
+    {"glutSpaceballMotionFunc", Glut_GlutSpaceballMotionFuncFunctionWrapper, 2, "s"},
+    {"glutSpaceballRotateFunc", Glut_GlutSpaceballRotateFuncFunctionWrapper, 2, "s"},
+    {"glutSpecialFunc", Glut_GlutSpecialFuncFunctionWrapper, 2, "s"},
+    {"glutSpecialUpFunc", Glut_GlutSpecialUpFuncFunctionWrapper, 0, NULL},
+    {"glutStopVideoResizing", Glut_GlutStopVideoResizingFunctionWrapper, 0, NULL},
+    {"glutStrokeCharacter", Glut_GlutStrokeCharacterFunctionWrapper, 3, "ss"},
+    {"glutStrokeLength", Glut_GlutStrokeLengthFunctionWrapper, 0, NULL},
+    {"glutStrokeWidth", Glut_GlutStrokeWidthFunctionWrapper, 3, "ss"},
+    {"glutSwapBuffers", Glut_GlutSwapBuffersFunctionWrapper, 1, NULL},
+    {"glutTabletButtonFunc", Glut_GlutTabletButtonFuncFunctionWrapper, 2, "s"},
+    {"glutTabletMotionFunc", Glut_GlutTabletMotionFuncFunctionWrapper, 2, "s"},
+    {"glutTimerFunc", Glut_GlutTimerFuncFunctionWrapper, 4, "isi"},
+    {"glutUseLayer", Glut_GlutUseLayerFunctionWrapper, 2, "n"},
+    {"glutVideoPan", Glut_GlutVideoPanFunctionWrapper, 0, NULL},
+    {"glutVideoResize", Glut_GlutVideoResizeFunctionWrapper, 0, NULL},
+    {"glutVideoResizeGet", Glut_GlutVideoResizeGetFunctionWrapper, 0, NULL},
+    {"glutVisibilityFunc", Glut_GlutVisibilityFuncFunctionWrapper, 2, "s"},
+    {"glutWarpPointer", Glut_GlutWarpPointerFunctionWrapper, 0, NULL},
+    {"glutWindowStatusFunc", Glut_GlutWindowStatusFuncFunctionWrapper, 0, NULL},
+    {"glutWireCone", Glut_GlutWireConeFunctionWrapper, 5, "nnnn"},
+    {"glutWireCube", Glut_GlutWireCubeFunctionWrapper, 2, "n"},
+    {"glutWireDodecahedron", Glut_GlutWireDodecahedronFunctionWrapper, 1, NULL},
+    {"glutWireIcosahedron", Glut_GlutWireIcosahedronFunctionWrapper, 1, NULL},
+    {"glutWireOctahedron", Glut_GlutWireOctahedronFunctionWrapper, 1, NULL},
+    {"glutWireSphere", Glut_GlutWireSphereFunctionWrapper, 4, "nnn"},
+    {"glutWireTeapot", Glut_GlutWireTeapotFunctionWrapper, 2, "n"},
+    {"glutWireTetrahedron", Glut_GlutWireTetrahedronFunctionWrapper, 1, NULL},
+    {"glutWireTorus", Glut_GlutWireTorusFunctionWrapper, 5, "nnnn"},
+    {NULL, NULL, 0, NULL}
+};
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glut_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *
+ * Description:
+ *     Install the extension functions.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure containing the variable and function namespace;
+ *     argc,      the number of command line arguments;
+ *     argv,      the command line arguments;
+ *     env,       a pointer to the environment variables;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Install the extension functions.
+ */
+Gua_Status Glut_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+{
+    Gua_Function function;
+    Gua_Object object;
+    Gua_String errMessage;
+    
+    globalNameSpace = nspace;
+    
+    /* Define the function wrapper to each extension function... */
+    Gua_SetFunctions((Gua_Namespace *)nspace, Glut_Functions, error);
     if (Gua_SetFunction((Gua_Namespace *)nspace, "", &function) != GUA_OK) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
         sprintf(errMessage, "%s %-.20s...\n", "can't set function", "");
@@ -37,7 +37,6 @@
 #include "glw.h"
 
 #define EXPRESSION_SIZE  4096
-#define ERROR_SIZE  65536
 
 /**
  * Group:
@@ -79,27 +78,26 @@ void Glw_DisplayFunc(void *window)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_DISPLAYFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 2;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -111,8 +109,7 @@ void Glw_DisplayFunc(void *window)
     Gua_NewHandle(h, "Glwm_Window", window);
     Gua_HandleToObject(argv[1], (struct Gua_Handle *)h);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -142,13 +139,13 @@ void Glw_DisplayFunc(void *window)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -191,27 +188,26 @@ void Glw_ReshapeFunc(void *window)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_RESHAPEFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 2;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -223,8 +219,7 @@ void Glw_ReshapeFunc(void *window)
     Gua_NewHandle(h, "Glwm_Window", window);
     Gua_HandleToObject(argv[1], (struct Gua_Handle *)h);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -254,13 +249,13 @@ void Glw_ReshapeFunc(void *window)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -303,27 +298,26 @@ void Glw_IdleFunc(void *window)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_IDLEFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 2;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -335,8 +329,7 @@ void Glw_IdleFunc(void *window)
     Gua_NewHandle(h, "Glwm_Window", window);
     Gua_HandleToObject(argv[1], (struct Gua_Handle *)h);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -366,13 +359,13 @@ void Glw_IdleFunc(void *window)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -418,27 +411,26 @@ void Glw_KeyPressFunc(void *window, unsigned char c, int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_KEYPRESSFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 5;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -455,8 +447,7 @@ void Glw_KeyPressFunc(void *window, unsigned char c, int x, int y)
     Gua_IntegerToObject(argv[3], x);
     Gua_IntegerToObject(argv[4], y);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -486,13 +477,13 @@ void Glw_KeyPressFunc(void *window, unsigned char c, int x, int y)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -538,27 +529,26 @@ void Glw_KeyReleaseFunc(void *window, unsigned char c, int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_KEYRELEASEFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 5;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -575,8 +565,7 @@ void Glw_KeyReleaseFunc(void *window, unsigned char c, int x, int y)
     Gua_IntegerToObject(argv[3], x);
     Gua_IntegerToObject(argv[4], y);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -606,13 +595,13 @@ void Glw_KeyReleaseFunc(void *window, unsigned char c, int x, int y)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -655,27 +644,26 @@ void Glw_MouseEnterFunc(void *window)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_MOUSEENTERFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 2;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -687,8 +675,7 @@ void Glw_MouseEnterFunc(void *window)
     Gua_NewHandle(h, "Glwm_Window", window);
     Gua_HandleToObject(argv[1], (struct Gua_Handle *)h);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -718,13 +705,13 @@ void Glw_MouseEnterFunc(void *window)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -767,27 +754,26 @@ void Glw_MouseLeaveFunc(void *window)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_MOUSELEAVEFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 2;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -799,8 +785,7 @@ void Glw_MouseLeaveFunc(void *window)
     Gua_NewHandle(h, "Glwm_Window", window);
     Gua_HandleToObject(argv[1], (struct Gua_Handle *)h);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -830,13 +815,13 @@ void Glw_MouseLeaveFunc(void *window)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -881,27 +866,26 @@ void Glw_MouseMotionFunc(void *window, int x, int y)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_MOUSEMOTIONFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 4;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -917,8 +901,7 @@ void Glw_MouseMotionFunc(void *window, int x, int y)
     Gua_IntegerToObject(argv[2], x);
     Gua_IntegerToObject(argv[3], y);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -948,13 +931,13 @@ void Glw_MouseMotionFunc(void *window, int x, int y)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -1001,27 +984,26 @@ void Glw_MouseButtonPressFunc(void *window, unsigned int button, unsigned int st
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_MOUSEBUTTONPRESSFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 6;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -1039,8 +1021,7 @@ void Glw_MouseButtonPressFunc(void *window, unsigned int button, unsigned int st
     Gua_IntegerToObject(argv[4], x);
     Gua_IntegerToObject(argv[5], y);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -1070,13 +1051,13 @@ void Glw_MouseButtonPressFunc(void *window, unsigned int button, unsigned int st
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -1123,27 +1104,26 @@ void Glw_MouseButtonReleaseFunc(void *window, unsigned int button, unsigned int
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_MOUSEBUTTONRELEASEFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 6;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -1161,8 +1141,7 @@ void Glw_MouseButtonReleaseFunc(void *window, unsigned int button, unsigned int
     Gua_IntegerToObject(argv[4], x);
     Gua_IntegerToObject(argv[5], y);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -1192,13 +1171,13 @@ void Glw_MouseButtonReleaseFunc(void *window, unsigned int button, unsigned int
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -1241,27 +1220,26 @@ void Glw_CloseFunc(void *window)
     expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
     sprintf(expression, "$GLWM_CLOSEFUNC[\"%p\"]", window);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     p = expression;
-    p = Gua_Expression(nspace, p, &callback, &status, error);
+    p = Gua_EvaluateCached(nspace, p, &callback, &status, error);
     
     if (status != GUA_OK) {
         printf("\nError: %s", error);
         
         Gua_Free(expression);
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         exit(1);
     }
     
     Gua_Free(expression);
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
     
     /* Prepare the arguments array to be passed to the callback function. */
     argc = 2;
-    argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+    argv = Gua_AllocArguments(argc);
     
     Gua_ClearArguments(argc, argv);
     
@@ -1273,8 +1251,7 @@ void Glw_CloseFunc(void *window)
     Gua_NewHandle(h, "Glwm_Window", window);
     Gua_HandleToObject(argv[1], (struct Gua_Handle *)h);
     
-    error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-    *error = '\0';
+    error = Gua_AllocErrorBuffer();
     
     /* Call the callback function. */
     if (Gua_GetFunction(nspace, Gua_ObjectToString(callback), &function) == GUA_OK) {
@@ -1304,13 +1281,13 @@ void Glw_CloseFunc(void *window)
         if (!((status == GUA_RETURN) || (status == GUA_EXIT))) {
             printf("\nError: %s", error);
             
-            Gua_Free(error);
+            Gua_FreeErrorBuffer(error);
             
             exit(1);
         }
     }
     
-    Gua_Free(error);
+    Gua_FreeErrorBuffer(error);
 }
 
 /**
@@ -1318,10 +1295,10 @@ void Glw_CloseFunc(void *window)
  *     C
  *
  * Function:
- *     Gua_Status Glw_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Glw_GlwmCloseWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     GlwmCloseWindow function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -1334,15 +1311,58 @@ void Glw_CloseFunc(void *window)
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Glw_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Glw_GlwmCloseWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Namespace *top;
     Gua_Handle *h;
     void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Gua_IntegerToPObject(object, Glwm_CloseWindow((Glwm_Window *)arg1p));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmCreateWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmCreateWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmCreateWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Namespace *top;
+    Gua_Handle *h;
     Glwm_Window *window;
-    Gua_String expression;
-    Gua_String p;
-    Gua_Status status;
     Gua_String errMessage;
     
     top = (Gua_Namespace *)nspace;
@@ -1350,1183 +1370,1589 @@ Gua_Status Glw_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
         top = (Gua_Namespace *)top->previous;
     }
     
-    arg1p = NULL;
-    
-    if (argc == 0) {
+    if (argc < 2) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
-
+        
         return GUA_ERROR;
     }
-
-    if (strcmp(Gua_ObjectToString(argv[0]), "glwmCloseWindow") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        Gua_IntegerToPObject(object, Glwm_CloseWindow((Glwm_Window *)arg1p));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmCreateWindow") == 0) {
-        if (argc < 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
+    
 		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        window = (Glwm_Window *)Glwm_CreateWindow(Gua_ObjectToString(argv[1]));
-        Glwm_SetUserData(window, top);
-        
-        if (window != NULL) {
-            Gua_NewHandle(h, "Glwm_Window", window);
-            
-            Gua_HandleToPObject(object, (struct Gua_Handle *)h);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmDestroyWindow") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        Glwm_DestroyWindow((Glwm_Window *)arg1p);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmExitMainLoop") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Glwm_ExitMainLoop();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmGetTime") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_RealToPObject(object, Glwm_GetTime());
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmHideWindow") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        Glwm_HideWindow((Glwm_Window *)arg1p);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmMainIteration") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Glwm_MainIteration();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmMainLoop") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Glwm_MainLoop();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmMakeCurrent") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        Glwm_MakeCurrent((Glwm_Window *)arg1p);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterCloseFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_CLOSEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+        return GUA_ERROR;
+    }
+    
+    window = (Glwm_Window *)Glwm_CreateWindow(Gua_ObjectToString(argv[1]));
+    Glwm_SetUserData(window, top);
+    
+    if (window != NULL) {
+        Gua_NewHandle(h, "Glwm_Window", window);
         
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
+        Gua_HandleToPObject(object, (struct Gua_Handle *)h);
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmDestroyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmDestroyWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmDestroyWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_Free(expression);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Glwm_DestroyWindow((Glwm_Window *)arg1p);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmExitMainLoopFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmExitMainLoop function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmExitMainLoopFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Glwm_ExitMainLoop();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmGetTimeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmGetTime function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmGetTimeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_RealToPObject(object, Glwm_GetTime());
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmHideWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmHideWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmHideWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Glwm_RegisterCloseFunc((Glwm_Window *)arg1p, &Glw_CloseFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterDisplayFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_DISPLAYFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterDisplayFunc((Glwm_Window *)arg1p, &Glw_DisplayFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterIdleFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_IDLEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterIdleFunc((Glwm_Window *)arg1p, &Glw_IdleFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterKeyPressFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_KEYPRESSFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterKeyPressFunc((Glwm_Window *)arg1p, &Glw_KeyPressFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterKeyReleaseFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_KEYRELEASEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterKeyReleaseFunc((Glwm_Window *)arg1p, &Glw_KeyReleaseFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterMouseButtonPressFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_MOUSEBUTTONPRESSFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterMouseButtonPressFunc((Glwm_Window *)arg1p, &Glw_MouseButtonPressFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterMouseButtonReleaseFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_MOUSEBUTTONRELEASEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterMouseButtonReleaseFunc((Glwm_Window *)arg1p, &Glw_MouseButtonReleaseFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterMouseEnterFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_MOUSEENTERFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterMouseEnterFunc((Glwm_Window *)arg1p, &Glw_MouseEnterFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterMouseLeaveFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_MOUSELEAVEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterMouseLeaveFunc((Glwm_Window *)arg1p, &Glw_MouseLeaveFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterMouseMotionFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_MOUSEMOTIONFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterMouseMotionFunc((Glwm_Window *)arg1p, &Glw_MouseMotionFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmRegisterReshapeFunc") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
-        sprintf(expression, "$GLWM_RESHAPEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
-        
-        p = expression;
-        p = Gua_Expression(nspace, p, object, &status, error);
-        if (!Gua_IsPObjectStored(object)) {
-            Gua_FreeObject(object);
-        }
-        
-        Gua_Free(expression);
-        
-        Glwm_RegisterReshapeFunc((Glwm_Window *)arg1p, &Glw_ReshapeFunc);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmSetCloseWindow") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Glwm_HideWindow((Glwm_Window *)arg1p);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmMainIterationFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmMainIteration function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmMainIterationFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Glwm_MainIteration();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmMainLoopFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmMainLoop function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmMainLoopFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Glwm_MainLoop();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmMakeCurrentFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmMakeCurrent function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmMakeCurrentFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Glwm_MakeCurrent((Glwm_Window *)arg1p);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterCloseFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterCloseFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterCloseFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_CLOSEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterCloseFunc((Glwm_Window *)arg1p, &Glw_CloseFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterDisplayFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterDisplayFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterDisplayFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Glwm_SetCloseWindow((Glwm_Window *)arg1p, Gua_ObjectToInteger(argv[2]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmSetWindowPos") == 0) {
-        if (argc < 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_DISPLAYFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterDisplayFunc((Glwm_Window *)arg1p, &Glw_DisplayFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterIdleFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterIdleFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterIdleFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_IDLEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterIdleFunc((Glwm_Window *)arg1p, &Glw_IdleFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterKeyPressFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterKeyPressFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterKeyPressFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_KEYPRESSFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterKeyPressFunc((Glwm_Window *)arg1p, &Glw_KeyPressFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterKeyReleaseFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterKeyReleaseFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterKeyReleaseFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_KEYRELEASEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterKeyReleaseFunc((Glwm_Window *)arg1p, &Glw_KeyReleaseFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterMouseButtonPressFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterMouseButtonPressFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterMouseButtonPressFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_MOUSEBUTTONPRESSFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterMouseButtonPressFunc((Glwm_Window *)arg1p, &Glw_MouseButtonPressFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterMouseButtonReleaseFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterMouseButtonReleaseFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterMouseButtonReleaseFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Glwm_SetWindowPos((Glwm_Window *)arg1p, Gua_ObjectToInteger(argv[2]), Gua_ObjectToInteger(argv[3]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmSetWindowSize") == 0) {
-        if (argc < 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_MOUSEBUTTONRELEASEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterMouseButtonReleaseFunc((Glwm_Window *)arg1p, &Glw_MouseButtonReleaseFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterMouseEnterFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterMouseEnterFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterMouseEnterFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_MOUSEENTERFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterMouseEnterFunc((Glwm_Window *)arg1p, &Glw_MouseEnterFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterMouseLeaveFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterMouseLeaveFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterMouseLeaveFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_MOUSELEAVEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterMouseLeaveFunc((Glwm_Window *)arg1p, &Glw_MouseLeaveFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterMouseMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterMouseMotionFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterMouseMotionFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_MOUSEMOTIONFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterMouseMotionFunc((Glwm_Window *)arg1p, &Glw_MouseMotionFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmRegisterReshapeFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmRegisterReshapeFunc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmRegisterReshapeFuncFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String expression;
+    Gua_String p;
+    Gua_Status status;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    expression = (char *)Gua_Alloc(sizeof(char) * EXPRESSION_SIZE);
+    sprintf(expression, "$GLWM_RESHAPEFUNC[\"%p\"] = \"%s\";", arg1p, Gua_ObjectToString(argv[2]));
+    
+    p = expression;
+    p = Gua_Expression(nspace, p, object, &status, error);
+    if (!Gua_IsPObjectStored(object)) {
+        Gua_FreeObject(object);
+    }
+    
+    Gua_Free(expression);
+    
+    Glwm_RegisterReshapeFunc((Glwm_Window *)arg1p, &Glw_ReshapeFunc);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmSetCloseWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmSetCloseWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmSetCloseWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Glwm_SetWindowSize((Glwm_Window *)arg1p, Gua_ObjectToInteger(argv[2]), Gua_ObjectToInteger(argv[3]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmSetWindowTitle") == 0) {
-        if (argc < 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Glwm_SetCloseWindow((Glwm_Window *)arg1p, Gua_ObjectToInteger(argv[2]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmSetWindowPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmSetWindowPos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmSetWindowPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    if (argc < 4) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
+        return GUA_ERROR;
+    }
+    
 		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        Glwm_SetWindowTitle((Glwm_Window *)arg1p, Gua_ObjectToString(argv[2]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmShowWindow") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        Glwm_ShowWindow((Glwm_Window *)arg1p);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmSwapBuffers") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-        
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Glwm_SwapBuffers((Glwm_Window *)arg1p);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmTerminate") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Glwm_Terminate();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmWindowHeight") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        return GUA_ERROR;
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Glwm_SetWindowPos((Glwm_Window *)arg1p, Gua_ObjectToInteger(argv[2]), Gua_ObjectToInteger(argv[3]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmSetWindowSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmSetWindowSize function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmSetWindowSizeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    if (argc < 4) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_IntegerToPObject(object, Glwm_WindowHeight((Glwm_Window *)arg1p));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmWindowWidth") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Glwm_SetWindowSize((Glwm_Window *)arg1p, Gua_ObjectToInteger(argv[2]), Gua_ObjectToInteger(argv[3]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmSetWindowTitleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmSetWindowTitle function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmSetWindowTitleFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    if (argc < 3) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_IntegerToPObject(object, Glwm_WindowWidth((Glwm_Window *)arg1p));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmWindowXPos") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+		if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Glwm_SetWindowTitle((Glwm_Window *)arg1p, Gua_ObjectToString(argv[2]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmShowWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmShowWindow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmShowWindowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_IntegerToPObject(object, Glwm_WindowXPos((Glwm_Window *)arg1p));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "glwmWindowYPos") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Glwm_ShowWindow((Glwm_Window *)arg1p);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmSwapBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmSwapBuffers function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmSwapBuffersFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Glwm_SwapBuffers((Glwm_Window *)arg1p);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmTerminateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmTerminate function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmTerminateFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Glwm_Terminate();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmWindowHeightFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmWindowHeight function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmWindowHeightFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Gua_IntegerToPObject(object, Glwm_WindowHeight((Glwm_Window *)arg1p));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmWindowWidthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmWindowWidth function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmWindowWidthFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Gua_IntegerToPObject(object, Glwm_WindowWidth((Glwm_Window *)arg1p));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmWindowXPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmWindowXPos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmWindowXPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_IntegerToPObject(object, Glwm_WindowYPos((Glwm_Window *)arg1p));
+        return GUA_ERROR;
     }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Gua_IntegerToPObject(object, Glwm_WindowXPos((Glwm_Window *)arg1p));
+    
+    return GUA_OK;
+}
 
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Glw_GlwmWindowYPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     GlwmWindowYPos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Glw_GlwmWindowYPosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    void *arg1p;
+    Gua_String errMessage;
+    
+    arg1p = NULL;
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Glwm_Window") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    arg1p = Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    Gua_IntegerToPObject(object, Glwm_WindowYPos((Glwm_Window *)arg1p));
+    
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Glw_Functions[] = {
+    {"glwmCloseWindow", Glw_GlwmCloseWindowFunctionWrapper, 2, "h"},
+    {"glwmCreateWindow", Glw_GlwmCreateWindowFunctionWrapper, 0, NULL},
+    {"glwmDestroyWindow", Glw_GlwmDestroyWindowFunctionWrapper, 2, "h"},
+    {"glwmExitMainLoop", Glw_GlwmExitMainLoopFunctionWrapper, 1, NULL},
+    {"glwmHideWindow", Glw_GlwmHideWindowFunctionWrapper, 2, "h"},
+    {"glwmGetTime", Glw_GlwmGetTimeFunctionWrapper, 1, NULL},
+    {"glwmMainIteration", Glw_GlwmMainIterationFunctionWrapper, 1, NULL},
+    {"glwmMainLoop", Glw_GlwmMainLoopFunctionWrapper, 1, NULL},
+    {"glwmMakeCurrent", Glw_GlwmMakeCurrentFunctionWrapper, 2, "h"},
+    {"glwmRegisterCloseFunc", Glw_GlwmRegisterCloseFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterDisplayFunc", Glw_GlwmRegisterDisplayFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterIdleFunc", Glw_GlwmRegisterIdleFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterKeyPressFunc", Glw_GlwmRegisterKeyPressFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterKeyReleaseFunc", Glw_GlwmRegisterKeyReleaseFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterMouseButtonPressFunc", Glw_GlwmRegisterMouseButtonPressFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterMouseButtonReleaseFunc", Glw_GlwmRegisterMouseButtonReleaseFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterMouseEnterFunc", Glw_GlwmRegisterMouseEnterFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterMouseLeaveFunc", Glw_GlwmRegisterMouseLeaveFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterMouseMotionFunc", Glw_GlwmRegisterMouseMotionFuncFunctionWrapper, 3, "hs"},
+    {"glwmRegisterReshapeFunc", Glw_GlwmRegisterReshapeFuncFunctionWrapper, 3, "hs"},
+    {"glwmSetCloseWindow", Glw_GlwmSetCloseWindowFunctionWrapper, 3, "hi"},
+    {"glwmSetWindowPos", Glw_GlwmSetWindowPosFunctionWrapper, 0, NULL},
+    {"glwmSetWindowSize", Glw_GlwmSetWindowSizeFunctionWrapper, 0, NULL},
+    {"glwmSetWindowTitle", Glw_GlwmSetWindowTitleFunctionWrapper, 0, NULL},
+    {"glwmShowWindow", Glw_GlwmShowWindowFunctionWrapper, 2, "h"},
+    {"glwmSwapBuffers", Glw_GlwmSwapBuffersFunctionWrapper, 2, "h"},
+    {"glwmTerminate", Glw_GlwmTerminateFunctionWrapper, 1, NULL},
+    {"glwmWindowHeight", Glw_GlwmWindowHeightFunctionWrapper, 2, "h"},
+    {"glwmWindowWidth", Glw_GlwmWindowWidthFunctionWrapper, 2, "h"},
+    {"glwmWindowXPos", Glw_GlwmWindowXPosFunctionWrapper, 2, "h"},
+    {"glwmWindowYPos", Glw_GlwmWindowYPosFunctionWrapper, 2, "h"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -2549,228 +2975,11 @@ Gua_Status Glw_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, G
  */
 Gua_Status Glw_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
 
     /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmCloseWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmCloseWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmCreateWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmCreateWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmDestroyWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmDestroyWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmExitMainLoop", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmExitMainLoop");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmHideWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmHideWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmGetTime", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmGetTime");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmMainIteration", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmMainIteration");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmMainLoop", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmMainLoop");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmMakeCurrent", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmMakeCurrent");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterCloseFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterCloseFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterDisplayFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterDisplayFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterIdleFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterIdleFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterKeyPressFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterKeyPressFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterKeyReleaseFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterKeyReleaseFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterMouseButtonPressFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterMouseButtonPressFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterMouseButtonReleaseFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterMouseButtonReleaseFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterMouseEnterFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterMouseEnterFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterMouseLeaveFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterMouseLeaveFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterMouseMotionFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterMouseMotionFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmRegisterReshapeFunc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmRegisterReshapeFunc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmSetCloseWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmSetCloseWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmSetWindowPos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmSetWindowPos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmSetWindowSize", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmSetWindowSize");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmSetWindowTitle", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmSetWindowTitle");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmShowWindow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmShowWindow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmSwapBuffers", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmSwapBuffers");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmTerminate", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmTerminate");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmWindowHeight", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmWindowHeight");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmWindowWidth", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmWindowWidth");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmWindowXPos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmWindowXPos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Glw_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glwmWindowYPos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glwmWindowYPos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Glw_Functions, error);
 
     /* Define each extension constant... */
     Gua_IntegerToObject(object, GLWM_BUTTON_DOWN);
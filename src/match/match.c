@@ -194,7 +194,6 @@ Gua_Status Match_Glob(Gua_String directory, Gua_String pattern, Gua_Object *list
     Gua_Short i;
     DIR *dirPointer;
     struct dirent *dirEntry;
-    Gua_Element *previous;
     Gua_Element *newElement;
     Gua_String errMessage;
     
@@ -218,37 +217,14 @@ Gua_Status Match_Glob(Gua_String directory, Gua_String pattern, Gua_Object *list
         
         while ((dirEntry = readdir(dirPointer)) != NULL) {
             if (Match_Match(dirEntry->d_name, pattern)) {
-                if (i == 0) {
-                    /* Create the first element. */
-                    newElement = (Gua_Element *)Gua_Alloc(sizeof(Gua_Element));
-                    /* The element key. */
-                    Gua_IntegerToObject(newElement->key, i);
-                    /* The element object. */
-                    Gua_StringToObject(newElement->object, dirEntry->d_name);
-                    
-                    /* Set the target array chain. */
-                    newElement->previous = NULL;
-                    newElement->next = NULL;
-                    
-                    /* Link the first element. */
-                    Gua_ArrayToPObject(list, (struct Gua_Element *)newElement, 1);
-                    
-                    previous = (Gua_Element *)Gua_PObjectToArray(list);
-                } else {
-                    /* Create a new element. */
-                    newElement = (Gua_Element *)Gua_Alloc(sizeof(Gua_Element));
-                    /* The element key. */
-                    Gua_IntegerToObject(newElement->key, i);
-                    /* The element object. */
-                    Gua_StringToObject(newElement->object, dirEntry->d_name);
-                    
-                    /* Set the target array chain. */
-                    newElement->previous = (struct Gua_Element *)previous;
-                    newElement->next = NULL;
-                    
-                    previous->next = (struct Gua_Element *)newElement;
-                    previous = newElement;
-                }
+                /* Create a new element. */
+                newElement = (Gua_Element *)Gua_Alloc(sizeof(Gua_Element));
+                /* The element key. */
+                Gua_IntegerToObject(newElement->key, i);
+                /* The element object. */
+                Gua_StringToObject(newElement->object, dirEntry->d_name);
+                
+                Gua_AppendArrayElement(list, newElement);
                 
                 i++;
                 
@@ -260,9 +236,6 @@ Gua_Status Match_Glob(Gua_String directory, Gua_String pattern, Gua_Object *list
             }
         }
         
-        /* Update the array length entry. */
-        Gua_SetPObjectLength(list, i);
-        
         closedir(dirPointer);
     }
     
@@ -274,10 +247,10 @@ Gua_Status Match_Glob(Gua_String directory, Gua_String pattern, Gua_Object *list
  *     C
  *
  * Function:
- *     Gua_Status Match_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Match_GlobFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     Glob function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -290,21 +263,12 @@ Gua_Status Match_Glob(Gua_String directory, Gua_String pattern, Gua_Object *list
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Match_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Match_GlobFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
     Gua_String errMessage;
     
     Gua_ClearPObject(object);
     
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-
-        return GUA_ERROR;
-    }
-
     /**
      * Group:
      *     Scripting
@@ -315,49 +279,77 @@ Gua_Status Match_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv,
      * Description:
      *     Return the directory file list, matching the specified pattern.
      */
-    if (strcmp(Gua_ObjectToString(argv[0]), "glob") == 0) {
-        if ((argc < 3) || (argc > 4)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if ((argc < 3) || (argc > 4)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    if (argc == 4) {
+        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
-        
-        if (argc == 4) {
-            if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
-        
-        if (argc == 3) {
-            return Match_Glob(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]), object, -1, error);
-        } else {
-            return Match_Glob(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]), object, Gua_ObjectToInteger(argv[3]), error);
-        }
+    }
+    
+    if (argc == 3) {
+        return Match_Glob(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]), object, -1, error);
+    } else {
+        return Match_Glob(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2]), object, Gua_ObjectToInteger(argv[3]), error);
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Match_MatchFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Match function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Match_MatchFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -368,39 +360,18 @@ Gua_Status Match_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv,
      * Description:
      *     Return true if the string contents matches the specified pattern.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "match") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_IntegerToPObject(object, Match_Match(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2])));
-    }
-
+    Gua_IntegerToPObject(object, Match_Match(Gua_ObjectToString(argv[1]), Gua_ObjectToString(argv[2])));
+    
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Match_Functions[] = {
+    {"glob", Match_GlobFunctionWrapper, 0, NULL},
+    {"match", Match_MatchFunctionWrapper, 3, "ss"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -423,25 +394,11 @@ Gua_Status Match_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv,
  */
 Gua_Status Match_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
 
     /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Match_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "glob", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "glob");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Match_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "match", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "match");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Match_Functions, error);
     
     /**
      * Group:
@@ -39,15 +39,39 @@
 #include "interp.h"
 #include "math.h"
 
+/*
+ * Complex numbers functions:
+ *
+ * (a+b*i)/(c+d*i)=(a*c+b*d)/(c*c+d*d)+i*(b*c-a*d)/(c*c+d*d)
+ *
+ * cos(a+b*i)=cos(a)*cosh(b)-i*sin(a)*sinh(b)
+ * sin(a+b*i)=sin(a)*cosh(b)+i*cos(a)*sinh(b)
+ * tan(a+b*i)=sin(a+b*i)/cos(a+b*i)
+ *
+ * cosh(a+b*i)=cosh(a)*cos(b)+i*sinh(a)sin(b)
+ * sinh(a+b*i)=sinh(a)*cos(b)+i*cosh(a)sin(b)
+ * tanh(a+b*i)=sinh(a+b*i)/cosh(a+b*i)
+ *
+ * r=abs(a+b*i)=sqrt(a*a+b*b)
+ * t=arg(a+b*i)=atan(b/a)
+ *
+ * exp(a+b*i)=exp(a)*cos(b)+i*sin(b)
+ * log(a+b*i)=log(r)+i*t
+ *
+ * pow(a+b*i,n)=pow(r,n)*cos(n*t)+i*pow(r,n)*sin(n*t)
+ * sqrt(a+b*i)=sqrt(r)*cos(t/2)+i*sqrt(r)*sin(t/2)
+ *
+ */
+
 /**
  * Group:
  *     C
  *
  * Function:
- *     Gua_Status Math_MathFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Math_AcosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Math functions wrapper.
+ *     Acos function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -60,1081 +84,1394 @@
  * Results:
  *     The return value of the wrapped funcion.
  */
-Gua_Status Math_MathFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Math_AcosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, acos(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, acos(Gua_ObjectToReal(argv[1])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_AsinFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Asin function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_AsinFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, asin(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, asin(Gua_ObjectToReal(argv[1])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_AtanFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Atan function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_AtanFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, atan(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, atan(Gua_ObjectToReal(argv[1])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_Atan2FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Atan2 function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_Atan2FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToPObject(object, atan2(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        Gua_RealToPObject(object, atan2(Gua_ObjectToReal(argv[1]), Gua_ObjectToReal(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        Gua_RealToPObject(object, atan2(Gua_ObjectToInteger(argv[1]), Gua_ObjectToReal(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToPObject(object, atan2(Gua_ObjectToReal(argv[1]), Gua_ObjectToInteger(argv[2])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_CeilFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Ceil function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_CeilFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, ceil(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, ceil(Gua_ObjectToReal(argv[1])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_CosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Cos function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_CosFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Object o;
     Gua_Real a;
     Gua_Imaginary b;
-    Gua_Real c;
-    Gua_Imaginary d;
-    Gua_Real r;
-    Gua_Real t;
-    Gua_Real n;
-    Gua_Object sine;
-    Gua_Object cosine;
-    Gua_Integer i;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, cos(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, cos(Gua_ObjectToReal(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        Gua_ComplexToPObject(object, cos(a) * cosh(b), -sin(a) * sinh(b));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_CoshFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Cosh function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_CoshFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real a;
+    Gua_Imaginary b;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, cosh(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, cosh(Gua_ObjectToReal(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        Gua_ComplexToPObject(object, cosh(a) * cos(b), sinh(a) * sin(b));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_DegFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Deg function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_DegFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if ((Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) && (argv[1].type != OBJECT_TYPE_REAL)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, (Gua_ObjectToInteger(argv[1]) * 180.0 / MATH_PI));
+    } else {
+        Gua_RealToPObject(object, (Gua_ObjectToReal(argv[1]) * 180.0 / MATH_PI));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_DistFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Dist function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_DistFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Object o;
     Gua_String errMessage;
     
     Gua_ClearObject(o);
     
     Gua_ClearPObject(object);
-
-    if (argc == 0) {
+    
+    if (!((argc == 5) || (argc == 7))) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
         
         return GUA_ERROR;
     }
     
-    /*
-     * Complex numbers functions:
-     *
-     * (a+b*i)/(c+d*i)=(a*c+b*d)/(c*c+d*d)+i*(b*c-a*d)/(c*c+d*d)
-     *
-     * cos(a+b*i)=cos(a)*cosh(b)-i*sin(a)*sinh(b)
-     * sin(a+b*i)=sin(a)*cosh(b)+i*cos(a)*sinh(b)
-     * tan(a+b*i)=sin(a+b*i)/cos(a+b*i)
-     *
-     * cosh(a+b*i)=cosh(a)*cos(b)+i*sinh(a)sin(b)
-     * sinh(a+b*i)=sinh(a)*cos(b)+i*cosh(a)sin(b)
-     * tanh(a+b*i)=sinh(a+b*i)/cosh(a+b*i)
-     *
-     * r=abs(a+b*i)=sqrt(a*a+b*b)
-     * t=arg(a+b*i)=atan(b/a)
-     *
-     * exp(a+b*i)=exp(a)*cos(b)+i*sin(b)
-     * log(a+b*i)=log(r)+i*t
-     *
-     * pow(a+b*i,n)=pow(r,n)*cos(n*t)+i*pow(r,n)*sin(n*t)
-     * sqrt(a+b*i)=sqrt(r)*cos(t/2)+i*sqrt(r)*sin(t/2)
-     *
-     */
-    if (strcmp(Gua_ObjectToString(argv[0]), "acos") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, acos(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, acos(Gua_ObjectToReal(argv[1])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "asin") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, asin(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, asin(Gua_ObjectToReal(argv[1])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "atan") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, atan(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, atan(Gua_ObjectToReal(argv[1])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "atan2") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToPObject(object, atan2(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            Gua_RealToPObject(object, atan2(Gua_ObjectToReal(argv[1]), Gua_ObjectToReal(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            Gua_RealToPObject(object, atan2(Gua_ObjectToInteger(argv[1]), Gua_ObjectToReal(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToPObject(object, atan2(Gua_ObjectToReal(argv[1]), Gua_ObjectToInteger(argv[2])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "ceil") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, ceil(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, ceil(Gua_ObjectToReal(argv[1])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "cos") == 0) {
-        if (argc != 2) {
+        return GUA_ERROR;
+    }
+    if (argc == 7) {
+        if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
+        if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
-        
+    }
+
+    if (argc == 5) {
         if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, cos(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, cos(Gua_ObjectToReal(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            Gua_ComplexToPObject(object, cos(a) * cosh(b), -sin(a) * sinh(b));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "cosh") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[1]));
+            Gua_RealToObject(argv[1], Gua_ObjectToReal(o));
         }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, cosh(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, cosh(Gua_ObjectToReal(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            Gua_ComplexToPObject(object, cosh(a) * cos(b), sinh(a) * sin(b));
+        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[2]));
+            Gua_RealToObject(argv[2], Gua_ObjectToReal(o));
         }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "deg") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[3]));
+            Gua_RealToObject(argv[3], Gua_ObjectToReal(o));
         }
-        
-        if ((Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) && (argv[1].type != OBJECT_TYPE_REAL)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[4]));
+            Gua_RealToObject(argv[4], Gua_ObjectToReal(o));
         }
-        
+
+        /*
+         * x1 = argv[1], y1 = argv[2], x2 = argv[3], y2 = argv[4]
+         * d = sqrt((x2-x1)^2 + (y2-y1)^2)
+         */
+        Gua_RealToPObject(object, sqrt(pow(Gua_ObjectToReal(argv[3]) - Gua_ObjectToReal(argv[1]), 2) + pow(Gua_ObjectToReal(argv[4]) - Gua_ObjectToReal(argv[2]), 2)));
+    } else {
         if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, (Gua_ObjectToInteger(argv[1]) * 180.0 / MATH_PI));
-        } else {
-            Gua_RealToPObject(object, (Gua_ObjectToReal(argv[1]) * 180.0 / MATH_PI));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "dist") == 0) {
-        if (!((argc == 5) || (argc == 7))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[1]));
+            Gua_RealToObject(argv[1], Gua_ObjectToReal(o));
         }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[2]));
+            Gua_RealToObject(argv[2], Gua_ObjectToReal(o));
         }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[3]));
+            Gua_RealToObject(argv[3], Gua_ObjectToReal(o));
         }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[4]));
+            Gua_RealToObject(argv[4], Gua_ObjectToReal(o));
         }
-        if (!((Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[4]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[5]));
+            Gua_RealToObject(argv[5], Gua_ObjectToReal(o));
         }
-        if (argc == 7) {
-            if (!((Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[5]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-            if (!((Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[6]) == OBJECT_TYPE_REAL))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
+        if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
+            Gua_RealToObject(o, Gua_ObjectToInteger(argv[6]));
+            Gua_RealToObject(argv[6], Gua_ObjectToReal(o));
         }
 
-        if (argc == 5) {
-            if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[1]));
-                Gua_RealToObject(argv[1], Gua_ObjectToReal(o));
-            }
-            if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[2]));
-                Gua_RealToObject(argv[2], Gua_ObjectToReal(o));
-            }
-            if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[3]));
-                Gua_RealToObject(argv[3], Gua_ObjectToReal(o));
-            }
-            if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[4]));
-                Gua_RealToObject(argv[4], Gua_ObjectToReal(o));
-            }
-
-            /*
-             * x1 = argv[1], y1 = argv[2], x2 = argv[3], y2 = argv[4]
-             * d = sqrt((x2-x1)^2 + (y2-y1)^2)
-             */
-            Gua_RealToPObject(object, sqrt(pow(Gua_ObjectToReal(argv[3]) - Gua_ObjectToReal(argv[1]), 2) + pow(Gua_ObjectToReal(argv[4]) - Gua_ObjectToReal(argv[2]), 2)));
-        } else {
-            if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[1]));
-                Gua_RealToObject(argv[1], Gua_ObjectToReal(o));
-            }
-            if (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[2]));
-                Gua_RealToObject(argv[2], Gua_ObjectToReal(o));
-            }
-            if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[3]));
-                Gua_RealToObject(argv[3], Gua_ObjectToReal(o));
-            }
-            if (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[4]));
-                Gua_RealToObject(argv[4], Gua_ObjectToReal(o));
-            }
-            if (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[5]));
-                Gua_RealToObject(argv[5], Gua_ObjectToReal(o));
-            }
-            if (Gua_ObjectType(argv[6]) == OBJECT_TYPE_INTEGER) {
-                Gua_RealToObject(o, Gua_ObjectToInteger(argv[6]));
-                Gua_RealToObject(argv[6], Gua_ObjectToReal(o));
-            }
+        /*
+         * x1 = argv[1], y1 = argv[2], z1 = argv[3], x2 = argv[4], y2 = argv[5], z2 = argv[6]
+         * d = sqrt((x2-x1)^2 + (y2-y1)^2 + (z2-z1)^2)
+         */
+        Gua_RealToPObject(object, sqrt(pow(Gua_ObjectToReal(argv[4]) - Gua_ObjectToReal(argv[1]), 2) + pow(Gua_ObjectToReal(argv[5]) - Gua_ObjectToReal(argv[2]), 2) + pow(Gua_ObjectToReal(argv[6]) - Gua_ObjectToReal(argv[3]), 2)));
+    }
+    
+    return GUA_OK;
+}
 
-            /*
-             * x1 = argv[1], y1 = argv[2], z1 = argv[3], x2 = argv[4], y2 = argv[5], z2 = argv[6]
-             * d = sqrt((x2-x1)^2 + (y2-y1)^2 + (z2-z1)^2)
-             */
-            Gua_RealToPObject(object, sqrt(pow(Gua_ObjectToReal(argv[4]) - Gua_ObjectToReal(argv[1]), 2) + pow(Gua_ObjectToReal(argv[5]) - Gua_ObjectToReal(argv[2]), 2) + pow(Gua_ObjectToReal(argv[6]) - Gua_ObjectToReal(argv[3]), 2)));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "exp") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, exp(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, exp(Gua_ObjectToReal(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            Gua_ComplexToPObject(object, exp(a) * cos(b), sin(b));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fabs") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, labs(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, fabs(Gua_ObjectToReal(argv[1])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "factorial") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_ExpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Exp function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_ExpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real a;
+    Gua_Imaginary b;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, exp(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, exp(Gua_ObjectToReal(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        Gua_ComplexToPObject(object, exp(a) * cos(b), sin(b));
+    }
+    
+    return GUA_OK;
+}
 
-        if (Gua_ObjectToInteger(argv[1]) < 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if ((Gua_ObjectToInteger(argv[1]) == 0) || (Gua_ObjectToInteger(argv[1]) == 1)) {
-            Gua_IntegerToPObject(object, 1);
-        } else if (Gua_ObjectToInteger(argv[1]) > 1) {
-            Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[1]));
-            for (i = Gua_ObjectToInteger(argv[1]) - 1; i > 1; i--) {
-                Gua_IntegerToPObject(object, (Gua_PObjectToInteger(object) * i));
-            }
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "floor") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_FabsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fabs function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_FabsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, labs(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, fabs(Gua_ObjectToReal(argv[1])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_FactorialFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Factorial function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_FactorialFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer i;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectToInteger(argv[1]) < 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, floor(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, floor(Gua_ObjectToReal(argv[1])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fmax") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        return GUA_ERROR;
+    }
+    
+    if ((Gua_ObjectToInteger(argv[1]) == 0) || (Gua_ObjectToInteger(argv[1]) == 1)) {
+        Gua_IntegerToPObject(object, 1);
+    } else if (Gua_ObjectToInteger(argv[1]) > 1) {
+        Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[1]));
+        for (i = Gua_ObjectToInteger(argv[1]) - 1; i > 1; i--) {
+            Gua_IntegerToPObject(object, (Gua_PObjectToInteger(object) * i));
         }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_FloorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Floor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_FloorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, floor(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, floor(Gua_ObjectToReal(argv[1])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_FmaxFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fmax function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_FmaxFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Object o;
+    
+    Gua_ClearObject(o);
+    
+    Gua_ClearPObject(object);
+    
+    if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        if (Gua_ObjectToInteger(argv[1]) > Gua_ObjectToInteger(argv[2])) {
+            Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[1]));
+        } else {
+            Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[2]));
         }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        if (Gua_ObjectToReal(argv[1]) > Gua_ObjectToReal(argv[2])) {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
+        } else {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
         }
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        Gua_RealToObject(o, Gua_ObjectToInteger(argv[1]));
+        Gua_RealToObject(argv[1], Gua_ObjectToReal(o));
         
-        if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            if (Gua_ObjectToInteger(argv[1]) > Gua_ObjectToInteger(argv[2])) {
-                Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[1]));
-            } else {
-                Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[2]));
-            }
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            if (Gua_ObjectToReal(argv[1]) > Gua_ObjectToReal(argv[2])) {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
-            } else {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
-            }
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            Gua_RealToObject(o, Gua_ObjectToInteger(argv[1]));
-            Gua_RealToObject(argv[1], Gua_ObjectToReal(o));
-            
-            if (Gua_ObjectToReal(argv[1]) > Gua_ObjectToReal(argv[2])) {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
-            } else {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
-            }
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToObject(o, Gua_ObjectToInteger(argv[2]));
-            Gua_RealToObject(argv[2], Gua_ObjectToReal(o));
-            
-            if (Gua_ObjectToReal(argv[1]) > Gua_ObjectToReal(argv[2])) {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
-            } else {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
-            }
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fmin") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectToReal(argv[1]) > Gua_ObjectToReal(argv[2])) {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
+        } else {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
         }
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToObject(o, Gua_ObjectToInteger(argv[2]));
+        Gua_RealToObject(argv[2], Gua_ObjectToReal(o));
         
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectToReal(argv[1]) > Gua_ObjectToReal(argv[2])) {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
+        } else {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
         }
-        
-        if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            if (Gua_ObjectToInteger(argv[1]) < Gua_ObjectToInteger(argv[2])) {
-                Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[1]));
-            } else {
-                Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[2]));
-            }
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            if (Gua_ObjectToReal(argv[1]) < Gua_ObjectToReal(argv[2])) {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
-            } else {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
-            }
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            Gua_RealToObject(o, Gua_ObjectToInteger(argv[1]));
-            Gua_RealToObject(argv[1], Gua_ObjectToReal(o));
-            
-            if (Gua_ObjectToReal(argv[1]) < Gua_ObjectToReal(argv[2])) {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
-            } else {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
-            }
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToObject(o, Gua_ObjectToInteger(argv[2]));
-            Gua_RealToObject(argv[2], Gua_ObjectToReal(o));
-            
-            if (Gua_ObjectToReal(argv[1]) < Gua_ObjectToReal(argv[2])) {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
-            } else {
-                Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
-            }
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_FminFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fmin function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_FminFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Object o;
+    
+    Gua_ClearObject(o);
+    
+    Gua_ClearPObject(object);
+    
+    if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        if (Gua_ObjectToInteger(argv[1]) < Gua_ObjectToInteger(argv[2])) {
+            Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[1]));
+        } else {
+            Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[2]));
         }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "fmod") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        if (Gua_ObjectToReal(argv[1]) < Gua_ObjectToReal(argv[2])) {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
+        } else {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
         }
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        Gua_RealToObject(o, Gua_ObjectToInteger(argv[1]));
+        Gua_RealToObject(argv[1], Gua_ObjectToReal(o));
         
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectToReal(argv[1]) < Gua_ObjectToReal(argv[2])) {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
+        } else {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
         }
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToObject(o, Gua_ObjectToInteger(argv[2]));
+        Gua_RealToObject(argv[2], Gua_ObjectToReal(o));
         
-        if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToPObject(object, fmod(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            Gua_RealToPObject(object, fmod(Gua_ObjectToReal(argv[1]), Gua_ObjectToReal(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            Gua_RealToPObject(object, fmod(Gua_ObjectToInteger(argv[1]), Gua_ObjectToReal(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToPObject(object, fmod(Gua_ObjectToReal(argv[1]), Gua_ObjectToInteger(argv[2])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "ldexp") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToPObject(object, ldexp(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToPObject(object, ldexp(Gua_ObjectToReal(argv[1]), Gua_ObjectToInteger(argv[2])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "log") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, log(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, log(Gua_ObjectToReal(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            r = sqrt(a * a + b * b);
-            t = atan(b / a);
-            Gua_ComplexToPObject(object, log(r), t);
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "log10") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, log10(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, log10(Gua_ObjectToReal(argv[1])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "pow") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToPObject(object, pow(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            Gua_RealToPObject(object, pow(Gua_ObjectToReal(argv[1]), Gua_ObjectToReal(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            Gua_RealToPObject(object, pow(Gua_ObjectToInteger(argv[1]), Gua_ObjectToReal(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            Gua_RealToPObject(object, pow(Gua_ObjectToReal(argv[1]), Gua_ObjectToInteger(argv[2])));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            r = sqrt(a * a + b * b);
-            t = atan(b / a);
-            n = Gua_ObjectToInteger(argv[2]);
-            Gua_ComplexToPObject(object, pow(r, n) * cos(n * t), pow(r, n) * sin(n * t));
-        } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            r = sqrt(a * a + b * b);
-            t = atan(b / a);
-            n = Gua_ObjectToReal(argv[2]);
-            Gua_ComplexToPObject(object, pow(r, n) * cos(n * t), pow(r, n) * sin(n * t));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "rad") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if ((Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) && (argv[1].type != OBJECT_TYPE_REAL)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, (Gua_ObjectToInteger(argv[1]) * MATH_PI / 180.0));
-        } else {
-            Gua_RealToPObject(object, (Gua_ObjectToReal(argv[1]) * MATH_PI / 180.0));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "random") == 0) {
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (Gua_ObjectToReal(argv[1]) < Gua_ObjectToReal(argv[2])) {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
+        } else {
+            Gua_RealToPObject(object, Gua_ObjectToReal(argv[2]));
         }
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_FmodFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Fmod function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_FmodFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToPObject(object, fmod(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        Gua_RealToPObject(object, fmod(Gua_ObjectToReal(argv[1]), Gua_ObjectToReal(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        Gua_RealToPObject(object, fmod(Gua_ObjectToInteger(argv[1]), Gua_ObjectToReal(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToPObject(object, fmod(Gua_ObjectToReal(argv[1]), Gua_ObjectToInteger(argv[2])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_LdexpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Ldexp function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_LdexpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToPObject(object, ldexp(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToPObject(object, ldexp(Gua_ObjectToReal(argv[1]), Gua_ObjectToInteger(argv[2])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_LogFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Log function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_LogFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real a;
+    Gua_Imaginary b;
+    Gua_Real r;
+    Gua_Real t;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, log(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, log(Gua_ObjectToReal(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        r = sqrt(a * a + b * b);
+        t = atan(b / a);
+        Gua_ComplexToPObject(object, log(r), t);
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_Log10FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Log10 function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_Log10FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, log10(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, log10(Gua_ObjectToReal(argv[1])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_PowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Pow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_PowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real a;
+    Gua_Imaginary b;
+    Gua_Real r;
+    Gua_Real t;
+    Gua_Real n;
+    
+    Gua_ClearPObject(object);
+    
+    if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToPObject(object, pow(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        Gua_RealToPObject(object, pow(Gua_ObjectToReal(argv[1]), Gua_ObjectToReal(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        Gua_RealToPObject(object, pow(Gua_ObjectToInteger(argv[1]), Gua_ObjectToReal(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        Gua_RealToPObject(object, pow(Gua_ObjectToReal(argv[1]), Gua_ObjectToInteger(argv[2])));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER)) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        r = sqrt(a * a + b * b);
+        t = atan(b / a);
+        n = Gua_ObjectToInteger(argv[2]);
+        Gua_ComplexToPObject(object, pow(r, n) * cos(n * t), pow(r, n) * sin(n * t));
+    } else if ((Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_REAL)) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        r = sqrt(a * a + b * b);
+        t = atan(b / a);
+        n = Gua_ObjectToReal(argv[2]);
+        Gua_ComplexToPObject(object, pow(r, n) * cos(n * t), pow(r, n) * sin(n * t));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_RadFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Rad function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_RadFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if ((Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) && (argv[1].type != OBJECT_TYPE_REAL)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, (Gua_ObjectToInteger(argv[1]) * MATH_PI / 180.0));
+    } else {
+        Gua_RealToPObject(object, (Gua_ObjectToReal(argv[1]) * MATH_PI / 180.0));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_RandomFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Random function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_RandomFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
 #ifdef _WINDOWS_
-        Gua_RealToPObject(object, (1.0 * (rand() / (RAND_MAX + 1.0))));
+    Gua_RealToPObject(object, (1.0 * (rand() / (RAND_MAX + 1.0))));
 #else
-        Gua_RealToPObject(object, (1.0 * (random() / (RAND_MAX + 1.0))));
+    Gua_RealToPObject(object, (1.0 * (random() / (RAND_MAX + 1.0))));
 #endif
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "round") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, round(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, round(Gua_ObjectToReal(argv[1])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "roundl") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_IntegerToPObject(object, roundl(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_IntegerToPObject(object, roundl(Gua_ObjectToReal(argv[1])));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sin") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, sin(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, sin(Gua_ObjectToReal(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            Gua_ComplexToPObject(object, sin(a) * cosh(b), cos(a) * sinh(b));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sinh") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, sinh(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, sinh(Gua_ObjectToReal(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            Gua_ComplexToPObject(object, sinh(a) * cos(b), cosh(a) * sin(b));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sqrt") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            if (Gua_ObjectToInteger(argv[1]) > 0) {
-                Gua_RealToPObject(object, sqrt(Gua_ObjectToInteger(argv[1])));
-            } else {
-                Gua_ComplexToPObject(object, 0.0, sqrt(labs(Gua_ObjectToInteger(argv[1]))));
-            }
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            if (Gua_ObjectToReal(argv[1]) > 0) {
-                Gua_RealToPObject(object, sqrt(Gua_ObjectToReal(argv[1])));
-            } else {
-                Gua_ComplexToPObject(object, 0.0, sqrt(fabs(Gua_ObjectToReal(argv[1]))));
-            }
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            r = sqrt(a * a + b * b);
-            t = atan(b / a);
-            Gua_ComplexToPObject(object, sqrt(r) * cos(t / 2), sqrt(r) * sin(t / 2));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "srandom") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_RoundFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Round function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_RoundFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, round(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, round(Gua_ObjectToReal(argv[1])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_RoundlFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Roundl function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_RoundlFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_IntegerToPObject(object, roundl(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_IntegerToPObject(object, roundl(Gua_ObjectToReal(argv[1])));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_SinFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Sin function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_SinFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real a;
+    Gua_Imaginary b;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, sin(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, sin(Gua_ObjectToReal(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        Gua_ComplexToPObject(object, sin(a) * cosh(b), cos(a) * sinh(b));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_SinhFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Sinh function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_SinhFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real a;
+    Gua_Imaginary b;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, sinh(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, sinh(Gua_ObjectToReal(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        Gua_ComplexToPObject(object, sinh(a) * cos(b), cosh(a) * sin(b));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_SqrtFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Sqrt function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_SqrtFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real a;
+    Gua_Imaginary b;
+    Gua_Real r;
+    Gua_Real t;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        if (Gua_ObjectToInteger(argv[1]) > 0) {
+            Gua_RealToPObject(object, sqrt(Gua_ObjectToInteger(argv[1])));
+        } else {
+            Gua_ComplexToPObject(object, 0.0, sqrt(labs(Gua_ObjectToInteger(argv[1]))));
         }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        if (Gua_ObjectToReal(argv[1]) > 0) {
+            Gua_RealToPObject(object, sqrt(Gua_ObjectToReal(argv[1])));
+        } else {
+            Gua_ComplexToPObject(object, 0.0, sqrt(fabs(Gua_ObjectToReal(argv[1]))));
+        }
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        r = sqrt(a * a + b * b);
+        t = atan(b / a);
+        Gua_ComplexToPObject(object, sqrt(r) * cos(t / 2), sqrt(r) * sin(t / 2));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_SrandomFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Srandom function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_SrandomFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
 #ifdef _WINDOWS_
-            srand(Gua_ObjectToInteger(argv[1]));
+        srand(Gua_ObjectToInteger(argv[1]));
 #else
-            srandom(Gua_ObjectToInteger(argv[1]));
+        srandom(Gua_ObjectToInteger(argv[1]));
 #endif            
-            Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[1]));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_IntegerToPObject(object, Gua_ObjectToInteger(argv[1]));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
 #ifdef _WINDOWS_
-            srand(Gua_ObjectToReal(argv[1]));
+        srand(Gua_ObjectToReal(argv[1]));
 #else
-            srandom(Gua_ObjectToReal(argv[1]));
+        srandom(Gua_ObjectToReal(argv[1]));
 #endif            
-            
-            Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "tan") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, tan(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, tan(Gua_ObjectToReal(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            Gua_ComplexToObject(sine, sin(a) * cosh(b), cos(a) * sinh(b));
-            Gua_ComplexToObject(cosine, cos(a) * cosh(b), -sin(a) * sinh(b));
-            a = Gua_ObjectToReal(sine);
-            b = Gua_ObjectToImaginary(sine);
-            c = Gua_ObjectToReal(cosine);
-            d = Gua_ObjectToImaginary(cosine);
-            Gua_ComplexToPObject(object, (a * c + b * d) / (c * c + d * d), (b * c - a * d) / (c * c + d * d));
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "tanh") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
-            Gua_RealToPObject(object, tanh(Gua_ObjectToInteger(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
-            Gua_RealToPObject(object, tanh(Gua_ObjectToReal(argv[1])));
-        } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
-            a = Gua_ObjectToReal(argv[1]);
-            b = Gua_ObjectToImaginary(argv[1]);
-            Gua_ComplexToObject(sine, sinh(a) * cos(b), cosh(a) * sin(b));
-            Gua_ComplexToObject(cosine, cosh(a) * cos(b), sinh(a) * sin(b));
-            a = Gua_ObjectToReal(sine);
-            b = Gua_ObjectToImaginary(sine);
-            c = Gua_ObjectToReal(cosine);
-            d = Gua_ObjectToImaginary(cosine);
-            Gua_ComplexToPObject(object, (a * c + b * d) / (c * c + d * d), (b * c - a * d) / (c * c + d * d));
-        }
-    } else {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "unknown function", Gua_ObjectToString(argv[0]));
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
         
-        return GUA_ERROR;
+        Gua_RealToPObject(object, Gua_ObjectToReal(argv[1]));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_TanFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Tan function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_TanFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real a;
+    Gua_Imaginary b;
+    Gua_Real c;
+    Gua_Imaginary d;
+    Gua_Object sine;
+    Gua_Object cosine;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, tan(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, tan(Gua_ObjectToReal(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        Gua_ComplexToObject(sine, sin(a) * cosh(b), cos(a) * sinh(b));
+        Gua_ComplexToObject(cosine, cos(a) * cosh(b), -sin(a) * sinh(b));
+        a = Gua_ObjectToReal(sine);
+        b = Gua_ObjectToImaginary(sine);
+        c = Gua_ObjectToReal(cosine);
+        d = Gua_ObjectToImaginary(cosine);
+        Gua_ComplexToPObject(object, (a * c + b * d) / (c * c + d * d), (b * c - a * d) / (c * c + d * d));
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Math_TanhFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Tanh function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return value of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return value of the wrapped funcion.
+ */
+Gua_Status Math_TanhFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Real a;
+    Gua_Imaginary b;
+    Gua_Real c;
+    Gua_Imaginary d;
+    Gua_Object sine;
+    Gua_Object cosine;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) {
+        Gua_RealToPObject(object, tanh(Gua_ObjectToInteger(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_REAL) {
+        Gua_RealToPObject(object, tanh(Gua_ObjectToReal(argv[1])));
+    } else if (Gua_ObjectType(argv[1]) == OBJECT_TYPE_COMPLEX) {
+        a = Gua_ObjectToReal(argv[1]);
+        b = Gua_ObjectToImaginary(argv[1]);
+        Gua_ComplexToObject(sine, sinh(a) * cos(b), cosh(a) * sin(b));
+        Gua_ComplexToObject(cosine, cosh(a) * cos(b), sinh(a) * sin(b));
+        a = Gua_ObjectToReal(sine);
+        b = Gua_ObjectToImaginary(sine);
+        c = Gua_ObjectToReal(cosine);
+        d = Gua_ObjectToImaginary(cosine);
+        Gua_ComplexToPObject(object, (a * c + b * d) / (c * c + d * d), (b * c - a * d) / (c * c + d * d));
     }
     
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Math_Functions[] = {
+    {"acos", Math_AcosFunctionWrapper, 2, "n"},
+    {"asin", Math_AsinFunctionWrapper, 2, "n"},
+    {"atan", Math_AtanFunctionWrapper, 2, "n"},
+    {"atan2", Math_Atan2FunctionWrapper, 3, "nn"},
+    {"ceil", Math_CeilFunctionWrapper, 2, "n"},
+    {"cos", Math_CosFunctionWrapper, 2, "x"},
+    {"cosh", Math_CoshFunctionWrapper, 2, "x"},
+    {"deg", Math_DegFunctionWrapper, 2, NULL},
+    {"dist", Math_DistFunctionWrapper, 0, NULL},
+    {"exp", Math_ExpFunctionWrapper, 2, "x"},
+    {"fabs", Math_FabsFunctionWrapper, 2, "n"},
+    {"factorial", Math_FactorialFunctionWrapper, 2, "i"},
+    {"floor", Math_FloorFunctionWrapper, 2, "n"},
+    {"fmax", Math_FmaxFunctionWrapper, 3, "nn"},
+    {"fmin", Math_FminFunctionWrapper, 3, "nn"},
+    {"fmod", Math_FmodFunctionWrapper, 3, "nn"},
+    {"ldexp", Math_LdexpFunctionWrapper, 3, "ni"},
+    {"log", Math_LogFunctionWrapper, 2, "x"},
+    {"log10", Math_Log10FunctionWrapper, 2, "n"},
+    {"pow", Math_PowFunctionWrapper, 3, "xn"},
+    {"rad", Math_RadFunctionWrapper, 2, NULL},
+    {"random", Math_RandomFunctionWrapper, 1, NULL},
+    {"round", Math_RoundFunctionWrapper, 2, "n"},
+    {"roundl", Math_RoundlFunctionWrapper, 2, "n"},
+    {"sin", Math_SinFunctionWrapper, 2, "x"},
+    {"sinh", Math_SinhFunctionWrapper, 2, "x"},
+    {"sqrt", Math_SqrtFunctionWrapper, 2, "x"},
+    {"srandom", Math_SrandomFunctionWrapper, 2, "n"},
+    {"tan", Math_TanFunctionWrapper, 2, "x"},
+    {"tanh", Math_TanhFunctionWrapper, 2, "x"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -1157,191 +1494,10 @@ Gua_Status Math_MathFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
  */
 Gua_Status Math_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
     
-    Gua_LinkCFunctionToFunction(function, Math_MathFunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "acos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "acos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "asin", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "asin");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "atan", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "atan");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "atan2", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "atan2");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "ceil", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "ceil");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "cos", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "cos");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "cosh", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "cosh");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "deg", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "deg");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "dist", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "dist");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "exp", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "exp");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fabs", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fabs");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "factorial", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "factorial");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "floor", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "floor");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fmax", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fmax");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fmin", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fmin");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "fmod", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "fmod");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "ldexp", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "ldexp");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "log", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "log");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "log10", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "log10");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "pow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "pow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "rad", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "rad");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "random", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "random");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "round", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "round");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "roundl", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "roundl");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sin", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sin");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sinh", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sinh");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sqrt", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sqrt");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "srandom", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "srandom");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "tan", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "tan");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "tanh", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "tanh");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Math_Functions, error);
     
     Gua_RealToObject(object, MATH_E);
     Gua_SetStoredObject(object);
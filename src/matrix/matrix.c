@@ -352,7 +352,7 @@ Gua_Status Matrix_TransMatrix(Gua_Object *a, Gua_Object *b, Gua_String error)
         
         o1 = (Gua_Object *)m1->object;
         
-        Gua_MatrixToPObject(b, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), Gua_PObjectLength(a));
+        Gua_MatrixToPObject(b, (struct Gua_Matrix *)Gua_NewMatrix(), Gua_PObjectLength(a));
         m2 = (Gua_Matrix *)Gua_PObjectToMatrix(b);
         
         m2->dimc = m1->dimc;
@@ -361,7 +361,7 @@ Gua_Status Matrix_TransMatrix(Gua_Object *a, Gua_Object *b, Gua_String error)
         m2->dimv[0] = m1->dimv[1];
         m2->dimv[1] = m1->dimv[0];
         
-        m2->object = (struct Gua_Object *)Gua_Alloc(Gua_PObjectLength(a) * sizeof(Gua_Object));
+        m2->object = (struct Gua_Object *)Gua_AllocType(Gua_PObjectLength(a) * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
         o2 = (Gua_Object *)m2->object;
         
         for (i = 0; i < m1->dimv[0]; i++) {
@@ -539,7 +539,7 @@ Gua_Status Matrix_Cross(Gua_Object *a, Gua_Object *b, Gua_Object *c, Gua_String
         
         
         /* Create the result matrix. */
-        Gua_MatrixToPObject(c, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), Gua_PObjectLength(a));
+        Gua_MatrixToPObject(c, (struct Gua_Matrix *)Gua_NewMatrix(), Gua_PObjectLength(a));
         m3 = (Gua_Matrix *)Gua_PObjectToMatrix(c);
         
         m3->dimc = m1->dimc;
@@ -549,7 +549,7 @@ Gua_Status Matrix_Cross(Gua_Object *a, Gua_Object *b, Gua_Object *c, Gua_String
             m3->dimv[i] = m1->dimv[i];
         }
         
-        m3->object = (struct Gua_Object *)Gua_Alloc(Gua_PObjectLength(a) * sizeof(Gua_Object));
+        m3->object = (struct Gua_Object *)Gua_AllocType(Gua_PObjectLength(a) * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
         v3 = (Gua_Object *)m3->object;
         
         /* This release only supports real numbers. */
@@ -1432,7 +1432,7 @@ Gua_Status Matrix_DelRow(Gua_Object *source, Gua_Object n, Gua_Object *object, G
         
         os = (Gua_Object *)ms->object;
         
-        mt = (Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix));
+        mt = Gua_NewMatrix();
         
         mt->dimc = ms->dimc;
         mt->dimv = Gua_Alloc(mt->dimc * sizeof(Gua_Integer));
@@ -1440,7 +1440,7 @@ Gua_Status Matrix_DelRow(Gua_Object *source, Gua_Object n, Gua_Object *object, G
         mt->dimv[0] = ms->dimv[0] - 1;
         mt->dimv[1] = ms->dimv[1];
         
-        mt->object = (struct Gua_Object *)Gua_Alloc((Gua_PObjectLength(source) - ms->dimv[1]) * sizeof(Gua_Object));
+        mt->object = (struct Gua_Object *)Gua_AllocType((Gua_PObjectLength(source) - ms->dimv[1]) * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
         ot = (Gua_Object *)mt->object;
         
         k = 0;
@@ -1542,7 +1542,7 @@ Gua_Status Matrix_DelCol(Gua_Object *source, Gua_Object n, Gua_Object *object, G
         
         os = (Gua_Object *)ms->object;
         
-        mt = (Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix));
+        mt = Gua_NewMatrix();
         
         mt->dimc = ms->dimc;
         mt->dimv = Gua_Alloc(mt->dimc * sizeof(Gua_Integer));
@@ -1550,7 +1550,7 @@ Gua_Status Matrix_DelCol(Gua_Object *source, Gua_Object n, Gua_Object *object, G
         mt->dimv[0] = ms->dimv[0];
         mt->dimv[1] = ms->dimv[1] - 1;
         
-        mt->object = (struct Gua_Object *)Gua_Alloc((Gua_PObjectLength(source) - ms->dimv[0]) * sizeof(Gua_Object));
+        mt->object = (struct Gua_Object *)Gua_AllocType((Gua_PObjectLength(source) - ms->dimv[0]) * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
         ot = (Gua_Object *)mt->object;
         
         k = 0;
@@ -1963,10 +1963,10 @@ Gua_Status Matrix_MaxCells(Gua_Object *a, Gua_Object x1, Gua_Object y1, Gua_Obje
  *     C
  *
  * Function:
- *     Gua_Status Matrix_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Matrix_AvgFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Matrix functions wrapper.
+ *     Avg function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -1979,196 +1979,14 @@ Gua_Status Matrix_MaxCells(Gua_Object *a, Gua_Object x1, Gua_Object y1, Gua_Obje
  * Results:
  *     The return object of the wrapped funcion.
  */
-Gua_Status Matrix_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Matrix_AvgFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Matrix *m;
-    Gua_Object *o;
-    Gua_Length length;
-    Gua_Integer i;
-    Gua_Integer j;
     Gua_String errMessage;
     
     Gua_ClearPObject(object);
-
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-        
-        return GUA_ERROR;
-    }
     
-    if (strcmp(Gua_ObjectToString(argv[0]), "avg") == 0) {
-        if (argc != 2) {
-            if (argc != 6) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (argc == 6) {
-            if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
-
-        if (argc == 2) {
-            if (Matrix_Avg(&argv[1], object, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        } else if (argc == 6) {
-            if (Matrix_AvgCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "count") == 0) {
-        if (argc != 2) {
-            if (argc != 6) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (argc == 6) {
-            if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
-
-        if (argc == 2) {
-            if (Matrix_Count(&argv[1], object, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        } else if (argc == 6) {
-            if (Matrix_CountCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "cross") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Matrix_Cross(&argv[1], &argv[2], object, error) != GUA_OK) {
-            return GUA_ERROR;
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "delcol") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Matrix_DelCol(&argv[1], argv[2], object, error) != GUA_OK) {
-            return GUA_ERROR;
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "delrow") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Matrix_DelRow(&argv[1], argv[2], object, error) != GUA_OK) {
-            return GUA_ERROR;
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "det") == 0) {
-        if (argc != 2) {
+    if (argc != 2) {
+        if (argc != 6) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -2176,29 +1994,17 @@ Gua_Status Matrix_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object
             
             return GUA_ERROR;
         }
+    }
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Matrix_DetMatrix(&argv[1], object, error) != GUA_OK) {
-            return GUA_ERROR;
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "diag") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER))) {
+        return GUA_ERROR;
+    }
+    if (argc == 6) {
+        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -2206,110 +2012,50 @@ Gua_Status Matrix_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object
             
             return GUA_ERROR;
         }
-        if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_COMPLEX))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        length = Gua_ObjectToInteger(argv[1]) * Gua_ObjectToInteger(argv[2]);
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), length);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 2;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = Gua_ObjectToInteger(argv[1]);
-        m->dimv[1] = Gua_ObjectToInteger(argv[2]);
-        
-        if (length == 0) {
-            Gua_FreeObject(object);
-            Gua_Free(m->dimv);
-            return GUA_OK;
-        }
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(length * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        for (i = 0; i < m->dimv[0]; i++) {
-            for (j = 0; j < m->dimv[1]; j++) {
-                if (i == j) {
-                    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-                        Gua_IntegerToObject(o[i * m->dimv[1] + j], Gua_ObjectToInteger(argv[3]));
-                    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-                        Gua_RealToObject(o[i * m->dimv[1] + j], Gua_ObjectToReal(argv[3]));
-                    } else {
-                        Gua_ComplexToObject(o[i * m->dimv[1] + j], Gua_ObjectToReal(argv[3]), Gua_ObjectToImaginary(argv[3]));
-                    }
-                } else {
-                    if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
-                        Gua_IntegerToObject(o[i * m->dimv[1] + j], 0);
-                    } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
-                        Gua_RealToObject(o[i * m->dimv[1] + j], 0.0);
-                    } else {
-                        Gua_RealToObject(o[i * m->dimv[1] + j], 0.0);
-                    }
-                }
-            }
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "dot") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Matrix_Dot(&argv[1], &argv[2], object, error) != GUA_OK) {
-            return GUA_ERROR;
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "gauss") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
+    }
+
+    if (argc == 2) {
+        if (Matrix_Avg(&argv[1], object, error) != GUA_OK) {
             return GUA_ERROR;
         }
-        
-        if (Matrix_GaussMatrix(&argv[1], object, error) == 0) {
+    } else if (argc == 6) {
+        if (Matrix_AvgCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
             return GUA_ERROR;
         }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "jordan") == 0) {
-        if (argc != 2) {
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_CountFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Count function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_CountFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (argc != 2) {
+        if (argc != 6) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -2317,99 +2063,386 @@ Gua_Status Matrix_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object
             
             return GUA_ERROR;
         }
+    }
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
+        return GUA_ERROR;
+    }
+    if (argc == 6) {
+        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
-        
-        if (Matrix_JordanMatrix(&argv[1], object, error) == 0) {
+    }
+
+    if (argc == 2) {
+        if (Matrix_Count(&argv[1], object, error) != GUA_OK) {
             return GUA_ERROR;
         }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "max") == 0) {
-        if (argc != 2) {
-            if (argc != 6) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
+    } else if (argc == 6) {
+        if (Matrix_CountCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
             return GUA_ERROR;
         }
-        if (argc == 6) {
-            if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
-        
-        if (argc == 2) {
-            if (Matrix_Max(&argv[1], object, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        } else if (argc == 6) {
-            if (Matrix_MaxCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "min") == 0) {
-        if (argc != 2) {
-            if (argc != 6) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (argc == 6) {
-            if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
+    }
+    
+    return GUA_OK;
+}
 
-        if (argc == 2) {
-            if (Matrix_Min(&argv[1], object, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        } else if (argc == 6) {
-            if (Matrix_MinCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
-                return GUA_ERROR;
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_CrossFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Cross function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_CrossFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Matrix_Cross(&argv[1], &argv[2], object, error) != GUA_OK) {
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_DelcolFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Delcol function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_DelcolFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Matrix_DelCol(&argv[1], argv[2], object, error) != GUA_OK) {
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_DelrowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Delrow function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_DelrowFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Matrix_DelRow(&argv[1], argv[2], object, error) != GUA_OK) {
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_DetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Det function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_DetFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Matrix_DetMatrix(&argv[1], object, error) != GUA_OK) {
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_DiagFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Diag function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_DiagFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_Length length;
+    Gua_Integer i;
+    Gua_Integer j;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (!((Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) || (Gua_ObjectType(argv[3]) == OBJECT_TYPE_COMPLEX))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    length = Gua_ObjectToInteger(argv[1]) * Gua_ObjectToInteger(argv[2]);
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), length);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 2;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = Gua_ObjectToInteger(argv[1]);
+    m->dimv[1] = Gua_ObjectToInteger(argv[2]);
+    
+    if (length == 0) {
+        Gua_FreeObject(object);
+        Gua_Free(m->dimv);
+        return GUA_OK;
+    }
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(length * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    for (i = 0; i < m->dimv[0]; i++) {
+        for (j = 0; j < m->dimv[1]; j++) {
+            if (i == j) {
+                if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+                    Gua_IntegerToObject(o[i * m->dimv[1] + j], Gua_ObjectToInteger(argv[3]));
+                } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+                    Gua_RealToObject(o[i * m->dimv[1] + j], Gua_ObjectToReal(argv[3]));
+                } else {
+                    Gua_ComplexToObject(o[i * m->dimv[1] + j], Gua_ObjectToReal(argv[3]), Gua_ObjectToImaginary(argv[3]));
+                }
+            } else {
+                if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) {
+                    Gua_IntegerToObject(o[i * m->dimv[1] + j], 0);
+                } else if (Gua_ObjectType(argv[3]) == OBJECT_TYPE_REAL) {
+                    Gua_RealToObject(o[i * m->dimv[1] + j], 0.0);
+                } else {
+                    Gua_RealToObject(o[i * m->dimv[1] + j], 0.0);
+                }
             }
         }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "one") == 0) {
-        if (argc != 3) {
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_DotFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Dot function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_DotFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Matrix_Dot(&argv[1], &argv[2], object, error) != GUA_OK) {
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_GaussFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Gauss function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_GaussFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Matrix_GaussMatrix(&argv[1], object, error) == 0) {
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_JordanFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Jordan function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_JordanFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Matrix_JordanMatrix(&argv[1], object, error) == 0) {
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_MaxFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Max function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_MaxFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (argc != 2) {
+        if (argc != 6) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -2417,7 +2450,17 @@ Gua_Status Matrix_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object
             
             return GUA_ERROR;
         }
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER))) {
+    }
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (argc == 6) {
+        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -2425,137 +2468,257 @@ Gua_Status Matrix_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object
             
             return GUA_ERROR;
         }
-        
-        length = Gua_ObjectToInteger(argv[1]) * Gua_ObjectToInteger(argv[2]);
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), length);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 2;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = Gua_ObjectToInteger(argv[1]);
-        m->dimv[1] = Gua_ObjectToInteger(argv[2]);
-        
-        if (length == 0) {
-            Gua_FreeObject(object);
-            Gua_Free(m->dimv);
-            return GUA_OK;
-        }
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(length * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        for (i = 0; i < length; i++) {
-            Gua_RealToObject(o[i], 1.0);
+    }
+    
+    if (argc == 2) {
+        if (Matrix_Max(&argv[1], object, error) != GUA_OK) {
+            return GUA_ERROR;
         }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "rand") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
+    } else if (argc == 6) {
+        if (Matrix_MaxCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
             return GUA_ERROR;
         }
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER))) {
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_MinFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Min function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_MinFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (argc != 2) {
+        if (argc != 6) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
+    }
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        length = Gua_ObjectToInteger(argv[1]) * Gua_ObjectToInteger(argv[2]);
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), length);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 2;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = Gua_ObjectToInteger(argv[1]);
-        m->dimv[1] = Gua_ObjectToInteger(argv[2]);
-        
-        if (length == 0) {
-            Gua_FreeObject(object);
-            Gua_Free(m->dimv);
-            return GUA_OK;
-        }
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(length * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        for (i = 0; i < length; i++) {
-#ifdef _WINDOWS_
-            Gua_RealToObject(o[i], (1.0 * (rand() / (RAND_MAX + 1.0))));
-#else
-            Gua_RealToObject(o[i], (1.0 * (random() / (RAND_MAX + 1.0))));
-#endif
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sum") == 0) {
-        if (argc != 2) {
-            if (argc != 6) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
+        return GUA_ERROR;
+    }
+    if (argc == 6) {
+        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
-        if (argc == 6) {
-            if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
+    }
 
-        if (argc == 2) {
-            if (Matrix_Sum(&argv[1], object, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        } else if (argc == 6) {
-            if (Matrix_SumCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
-                return GUA_ERROR;
-            }
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sum2") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
+    if (argc == 2) {
+        if (Matrix_Min(&argv[1], object, error) != GUA_OK) {
             return GUA_ERROR;
         }
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
+    } else if (argc == 6) {
+        if (Matrix_MinCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
             return GUA_ERROR;
         }
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_OneFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     One function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_OneFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_Length length;
+    Gua_Integer i;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    
+    length = Gua_ObjectToInteger(argv[1]) * Gua_ObjectToInteger(argv[2]);
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), length);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 2;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = Gua_ObjectToInteger(argv[1]);
+    m->dimv[1] = Gua_ObjectToInteger(argv[2]);
+    
+    if (length == 0) {
+        Gua_FreeObject(object);
+        Gua_Free(m->dimv);
+        return GUA_OK;
+    }
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(length * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    for (i = 0; i < length; i++) {
+        Gua_RealToObject(o[i], 1.0);
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_RandFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Rand function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_RandFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_Length length;
+    Gua_Integer i;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Matrix_Sum2(&argv[1], object, error) != GUA_OK) {
-            return GUA_ERROR;
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "trans") == 0) {
-        if (argc != 2) {
+        return GUA_ERROR;
+    }
+    
+    length = Gua_ObjectToInteger(argv[1]) * Gua_ObjectToInteger(argv[2]);
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), length);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 2;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = Gua_ObjectToInteger(argv[1]);
+    m->dimv[1] = Gua_ObjectToInteger(argv[2]);
+    
+    if (length == 0) {
+        Gua_FreeObject(object);
+        Gua_Free(m->dimv);
+        return GUA_OK;
+    }
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(length * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    for (i = 0; i < length; i++) {
+#ifdef _WINDOWS_
+        Gua_RealToObject(o[i], (1.0 * (rand() / (RAND_MAX + 1.0))));
+#else
+        Gua_RealToObject(o[i], (1.0 * (random() / (RAND_MAX + 1.0))));
+#endif
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_SumFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Sum function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_SumFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (argc != 2) {
+        if (argc != 6) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -2563,65 +2726,193 @@ Gua_Status Matrix_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object
             
             return GUA_ERROR;
         }
+    }
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
+        return GUA_ERROR;
+    }
+    if (argc == 6) {
+        if (!((Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[3]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[4]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[5]) == OBJECT_TYPE_INTEGER))) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+            sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
             Gua_Free(errMessage);
             
             return GUA_ERROR;
         }
-        
-        if (Matrix_TransMatrix(&argv[1], object, error) != GUA_OK) {
-            return GUA_ERROR;
-        }    
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "zero") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
+    }
+
+    if (argc == 2) {
+        if (Matrix_Sum(&argv[1], object, error) != GUA_OK) {
             return GUA_ERROR;
         }
-        if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER))) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
+    } else if (argc == 6) {
+        if (Matrix_SumCells(&argv[1], argv[2], argv[3], argv[4], argv[5], object, error) != GUA_OK) {
             return GUA_ERROR;
         }
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_Sum2FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Sum2 function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_Sum2FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Matrix_Sum2(&argv[1], object, error) != GUA_OK) {
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_TransFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Trans function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_TransFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_ClearPObject(object);
+    
+    if (Matrix_TransMatrix(&argv[1], object, error) != GUA_OK) {
+        return GUA_ERROR;
+    }    
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Matrix_ZeroFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Zero function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Matrix_ZeroFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Matrix *m;
+    Gua_Object *o;
+    Gua_Length length;
+    Gua_Integer i;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (!((Gua_ObjectType(argv[1]) == OBJECT_TYPE_INTEGER) && (Gua_ObjectType(argv[2]) == OBJECT_TYPE_INTEGER))) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        length = Gua_ObjectToInteger(argv[1]) * Gua_ObjectToInteger(argv[2]);
-        
-        Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_Alloc(sizeof(Gua_Matrix)), length);
-        
-        m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
-        
-        m->dimc = 2;
-        m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
-        m->dimv[0] = Gua_ObjectToInteger(argv[1]);
-        m->dimv[1] = Gua_ObjectToInteger(argv[2]);
-        
-        if (length == 0) {
-            Gua_FreeObject(object);
-            Gua_Free(m->dimv);
-            return GUA_OK;
-        }
-        
-        m->object = (struct Gua_Object *)Gua_Alloc(length * sizeof(Gua_Object));
-        o = (Gua_Object *)m->object;
-        
-        for (i = 0; i < length; i++) {
-            Gua_RealToObject(o[i], 0.0);
-        }
+        return GUA_ERROR;
+    }
+    
+    length = Gua_ObjectToInteger(argv[1]) * Gua_ObjectToInteger(argv[2]);
+    
+    Gua_MatrixToPObject(object, (struct Gua_Matrix *)Gua_NewMatrix(), length);
+    
+    m = (Gua_Matrix *)Gua_PObjectToMatrix(object);
+    
+    m->dimc = 2;
+    m->dimv = Gua_Alloc(m->dimc * sizeof(Gua_Integer));
+    m->dimv[0] = Gua_ObjectToInteger(argv[1]);
+    m->dimv[1] = Gua_ObjectToInteger(argv[2]);
+    
+    if (length == 0) {
+        Gua_FreeObject(object);
+        Gua_Free(m->dimv);
+        return GUA_OK;
+    }
+    
+    m->object = (struct Gua_Object *)Gua_AllocType(length * sizeof(Gua_Object), MEMORY_TYPE_MATRIX);
+    o = (Gua_Object *)m->object;
+    
+    for (i = 0; i < length; i++) {
+        Gua_RealToObject(o[i], 0.0);
     }
     
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Matrix_Functions[] = {
+    {"avg", Matrix_AvgFunctionWrapper, 0, NULL},
+    {"count", Matrix_CountFunctionWrapper, 0, NULL},
+    {"cross", Matrix_CrossFunctionWrapper, 3, "mm"},
+    {"delcol", Matrix_DelcolFunctionWrapper, 3, "mi"},
+    {"delrow", Matrix_DelrowFunctionWrapper, 3, "mi"},
+    {"det", Matrix_DetFunctionWrapper, 2, "m"},
+    {"diag", Matrix_DiagFunctionWrapper, 4, NULL},
+    {"dot", Matrix_DotFunctionWrapper, 3, "mm"},
+    {"gauss", Matrix_GaussFunctionWrapper, 2, "m"},
+    {"jordan", Matrix_JordanFunctionWrapper, 2, "m"},
+    {"max", Matrix_MaxFunctionWrapper, 0, NULL},
+    {"min", Matrix_MinFunctionWrapper, 0, NULL},
+    {"one", Matrix_OneFunctionWrapper, 3, NULL},
+    {"rand", Matrix_RandFunctionWrapper, 3, NULL},
+    {"sum", Matrix_SumFunctionWrapper, 0, NULL},
+    {"sum2", Matrix_Sum2FunctionWrapper, 2, "m"},
+    {"trans", Matrix_TransFunctionWrapper, 2, "m"},
+    {"zero", Matrix_ZeroFunctionWrapper, 3, NULL},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -2644,119 +2935,10 @@ Gua_Status Matrix_MatrixFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object
  */
 Gua_Status Matrix_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
     
-    Gua_LinkCFunctionToFunction(function, Matrix_MatrixFunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "avg", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "avg");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "count", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "count");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "cross", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "cross");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "delcol", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "delcol");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "delrow", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "delrow");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "det", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "det");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "diag", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "diag");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "dot", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "dot");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gauss", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gauss");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "jordan", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "jordan");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "max", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "max");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "min", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "min");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "one", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "one");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "rand", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "rand");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sum", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sum");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sum2", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sum2");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "trans", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "trans");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "zero", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "zero");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Matrix_Functions, error);
     
     /**
      * Group:
@@ -140,7 +140,7 @@ Gua_Status Numeric_GaussLSS(Gua_Object *a, Gua_Object *b, Gua_Object *x, Gua_Str
         Gua_IntegerToObject(argv[2], n + 1);
         Gua_SetStoredObject(argv[2]);
         
-        Matrix_MatrixFunctionWrapper(nspace, argc, argv, &c, error);
+        Matrix_ZeroFunctionWrapper(nspace, argc, argv, &c, error);
     
         m3 = (Gua_Matrix *)Gua_ObjectToMatrix(c);
         o3 = (Gua_Object *)m3->object;
@@ -195,7 +195,7 @@ Gua_Status Numeric_GaussLSS(Gua_Object *a, Gua_Object *b, Gua_Object *x, Gua_Str
         Gua_IntegerToObject(argv[2], 1);
         Gua_SetStoredObject(argv[2]);
         
-        Matrix_MatrixFunctionWrapper(nspace, argc, argv, x, error);
+        Matrix_ZeroFunctionWrapper(nspace, argc, argv, x, error);
     
         m5 = (Gua_Matrix *)Gua_PObjectToMatrix(x);
         o5 = (Gua_Object *)m5->object;
@@ -227,10 +227,10 @@ Gua_Status Numeric_GaussLSS(Gua_Object *a, Gua_Object *b, Gua_Object *x, Gua_Str
  *     C
  *
  * Function:
- *     Gua_Status Numeric_NumericFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Numeric_GaussLSSFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Numeric computation functions wrapper.
+ *     GaussLSS function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -243,78 +243,47 @@ Gua_Status Numeric_GaussLSS(Gua_Object *a, Gua_Object *b, Gua_Object *x, Gua_Str
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Numeric_NumericFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Numeric_GaussLSSFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
     Gua_Matrix *m1;
     Gua_Matrix *m2;
     Gua_String errMessage;
     
     Gua_ClearPObject(object);
-
-    if (argc == 0) {
+    
+    m1 = (Gua_Matrix *)Gua_ObjectToMatrix(argv[1]);
+    m2 = (Gua_Matrix *)Gua_ObjectToMatrix(argv[2]);
+    
+    if (m1->dimv[0] != m2->dimv[0]) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
+        sprintf(errMessage, "%s...\n", "the matrices do not have compatible dimensions");
         strcat(error, errMessage);
         Gua_Free(errMessage);
         
         return GUA_ERROR;
     }
-    
-    if (strcmp(Gua_ObjectToString(argv[0]), "gaussLSS") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_MATRIX) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        m1 = (Gua_Matrix *)Gua_ObjectToMatrix(argv[1]);
-        m2 = (Gua_Matrix *)Gua_ObjectToMatrix(argv[2]);
-        
-        if (m1->dimv[0] != m2->dimv[0]) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s...\n", "the matrices do not have compatible dimensions");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (m2->dimv[1] != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s...\n", "the matrices do not have compatible dimensions");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (m2->dimv[1] != 1) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s...\n", "the matrices do not have compatible dimensions");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Numeric_GaussLSS(&argv[1], &argv[2], object, error) != GUA_OK) {
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    if (Numeric_GaussLSS(&argv[1], &argv[2], object, error) != GUA_OK) {
+        return GUA_ERROR;
     }
     
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Numeric_Functions[] = {
+    {"gaussLSS", Numeric_GaussLSSFunctionWrapper, 3, "mm"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -337,20 +306,13 @@ Gua_Status Numeric_NumericFunctionWrapper(void *nspace, Gua_Short argc, Gua_Obje
  */
 Gua_Status Numeric_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String expression;
     Gua_String p;
     Gua_Status status;
     Gua_String errMessage;
     
-    Gua_LinkCFunctionToFunction(function, Numeric_NumericFunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gaussLSS", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gaussLSS");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Numeric_Functions, error);
     
     Gua_RealToObject(object, NUMERIC_GOLDEN_NUMBER);
     Gua_SetStoredObject(object);
@@ -759,10 +759,10 @@ void Regex_Fail(Gua_String err, Gua_Char c)
  *     C
  *
  * Function:
- *     Gua_Status Regexp_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Regexp_RegexpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     Regexp function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -775,10 +775,9 @@ void Regex_Fail(Gua_String err, Gua_Char c)
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Regexp_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Regexp_RegexpFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
     Regexp_Regex regex;
-    Gua_String dst;
     Gua_String err;
     Gua_String errMessage;
     
@@ -786,15 +785,6 @@ Gua_Status Regexp_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
     
     memset(&regex, 0, sizeof(regex));
     
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-
-        return GUA_ERROR;
-    }
-    
     /**
      * Group:
      *     Scripting
@@ -806,43 +796,52 @@ Gua_Status Regexp_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
      *     Return true if the string contents matches the specified
      *     regular expression pattern.
      */
-    if (strcmp(Gua_ObjectToString(argv[0]), "regexp") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if ((err = Regexp_Compile(&regex, Gua_ObjectToString(argv[1]))) != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s in expression %-.20s...\n", err, Gua_ObjectToString(argv[1]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if ((err = Regexp_Compile(&regex, Gua_ObjectToString(argv[1]))) != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s in expression %-.20s...\n", err, Gua_ObjectToString(argv[1]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_IntegerToPObject(object, Regexp_Execute(&regex, Gua_ObjectToString(argv[2])));
+        return GUA_ERROR;
+    }
+    
+    Gua_IntegerToPObject(object, Regexp_Execute(&regex, Gua_ObjectToString(argv[2])));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Regexp_RegsubFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Regsub function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Regexp_RegsubFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Regexp_Regex regex;
+    Gua_String dst;
+    Gua_String err;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    memset(&regex, 0, sizeof(regex));
+    
     /**
      * Group:
      *     Scripting
@@ -863,67 +862,38 @@ Gua_Status Regexp_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
      *                Tags are numbered from 1 to 9. If the particular
      *                tagged sub-pattern does not exist, null is substituted.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "regsub") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if ((err = Regexp_Compile(&regex, Gua_ObjectToString(argv[1]))) != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s in expression %-.20s...\n", err, Gua_ObjectToString(argv[1]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if ((err = Regexp_Compile(&regex, Gua_ObjectToString(argv[1]))) != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s in expression %-.20s...\n", err, Gua_ObjectToString(argv[1]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        return GUA_ERROR;
+    } else {
+        if (Regexp_Execute(&regex, Gua_ObjectToString(argv[2])) == 0) {
+            Gua_StringToPObject(object, "");
         } else {
-            if (Regexp_Execute(&regex, Gua_ObjectToString(argv[2])) == 0) {
+            dst = (Gua_String) Gua_Alloc(10 * sizeof(char) * Gua_ObjectLength(argv[2]) + sizeof(char) * Gua_ObjectLength(argv[3]) + 1);
+            memset(dst, '\0', 10 * sizeof(char) * Gua_ObjectLength(argv[2]) + sizeof(char) * Gua_ObjectLength(argv[3]) + 1);
+            if (Regexp_Replace(&regex, Gua_ObjectToString(argv[3]), dst) == 0) {
                 Gua_StringToPObject(object, "");
             } else {
-                dst = (Gua_String) Gua_Alloc(10 * sizeof(char) * Gua_ObjectLength(argv[2]) + sizeof(char) * Gua_ObjectLength(argv[3]) + 1);
-                memset(dst, '\0', 10 * sizeof(char) * Gua_ObjectLength(argv[2]) + sizeof(char) * Gua_ObjectLength(argv[3]) + 1);
-                if (Regexp_Replace(&regex, Gua_ObjectToString(argv[3]), dst) == 0) {
-                    Gua_StringToPObject(object, "");
-                } else {
-                    Gua_StringToPObject(object, dst);
-                }
-                Gua_Free(dst);
+                Gua_StringToPObject(object, dst);
             }
+            Gua_Free(dst);
         }
     }
     
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Regexp_Functions[] = {
+    {"regexp", Regexp_RegexpFunctionWrapper, 3, "ss"},
+    {"regsub", Regexp_RegsubFunctionWrapper, 4, "sss"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -946,27 +916,13 @@ Gua_Status Regexp_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
  */
 Gua_Status Regexp_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
     
     globalNameSpace = nspace;
     
     /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Regexp_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "regexp", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "regexp");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Regexp_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "regsub", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "regsub");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Regexp_Functions, error);
        
     /* Define each extension constant... */
     Gua_LinkStringToObject(object, "");
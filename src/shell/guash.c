@@ -77,6 +77,75 @@
 #define ERROR_SIZE 65536
 #define GUA_SIZE  65536
 
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     int Guash_Option(int *argc, char ***argv, char *option)
+ *
+ * Description:
+ *     Consume a shell option without value, if it is the next argument.
+ *
+ * Arguments:
+ *     argc,      a pointer to the number of arguments;
+ *     argv,      a pointer to the arguments, argv[0] is the program name;
+ *     option,    the option name.
+ *
+ * Results:
+ *     The function returns true and moves the program name over the
+ *     option, or returns false and leaves the arguments as they are.
+ */
+static int Guash_Option(int *argc, char ***argv, char *option)
+{
+    if ((*argc < 2) || (strcmp((*argv)[1], option) != 0)) {
+        return false;
+    }
+    
+    (*argv)[1] = (*argv)[0];
+    *argc = *argc - 1;
+    *argv = *argv + 1;
+    
+    return true;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     char *Guash_OptionValue(int *argc, char ***argv, char *option)
+ *
+ * Description:
+ *     Consume a shell option and its value, if the option is the next
+ *     argument and a value follows it.
+ *
+ * Arguments:
+ *     argc,      a pointer to the number of arguments;
+ *     argv,      a pointer to the arguments, argv[0] is the program name;
+ *     option,    the option name.
+ *
+ * Results:
+ *     The function returns the option value and moves the program name
+ *     over it, or returns NULL and leaves the arguments as they are.
+ */
+static char *Guash_OptionValue(int *argc, char ***argv, char *option)
+{
+    char *value;
+    
+    if ((*argc < 3) || (strcmp((*argv)[1], option) != 0)) {
+        return NULL;
+    }
+    
+    value = (*argv)[2];
+    
+    (*argv)[2] = (*argv)[0];
+    *argc = *argc - 2;
+    *argv = *argv + 2;
+    
+    return value;
+}
+
 int main(int argc, char *argv[], char **env)
 {
     FILE *fp;
@@ -89,11 +158,38 @@ int main(int argc, char *argv[], char **env)
     Gua_Status status;
     Gua_String error;
     Gua_String expr;
+    Gua_String profile;
+    Gua_String folded;
+    Gua_String trace;
+    Gua_Short memstats;
+    Gua_String value;
     Gua_Integer exitCode;
     
     exitCode = 0;
+    profile = NULL;
+    trace = NULL;
+    memstats = false;
     
-    nspace = (Gua_Namespace *)Gua_Alloc(sizeof(Gua_Namespace));
+    /* Shell options come before the script name. */
+    while (argc > 1) {
+        if (Guash_Option(&argc, &argv, "--no-compile")) {
+            Gua_SetCompileMode(false);
+        } else if ((value = Guash_OptionValue(&argc, &argv, "--max-depth")) != NULL) {
+            Gua_SetMaxCallDepth(atol(value));
+        } else if ((value = Guash_OptionValue(&argc, &argv, "--profile")) != NULL) {
+            profile = value;
+        } else if (Guash_Option(&argc, &argv, "--memstats")) {
+            /* The blocks are counted from the first one. */
+            Gua_SetMemoryAccounting(true);
+            memstats = true;
+        } else if ((value = Guash_OptionValue(&argc, &argv, "--trace-stats")) != NULL) {
+            trace = value;
+        } else {
+            break;
+        }
+    }
+    
+    nspace = (Gua_Namespace *)Gua_AllocType(sizeof(Gua_Namespace), MEMORY_TYPE_NAMESPACE);
     error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
     expr = (Gua_String)Gua_Alloc(sizeof(char) * GUA_SIZE);
     
@@ -225,6 +321,20 @@ int main(int argc, char *argv[], char **env)
     /* Cleanup the the expression return object. */
     Gua_ClearObject(object);
     
+    /* Start the sampling profiler. */
+    if (profile) {
+        *error = '\0';
+        if (Gua_StartProfile(PROFILE_RATE, error) != GUA_OK) {
+            printf("\nError: %s\n", error);
+            profile = NULL;
+        }
+    }
+    
+    /* Start counting the function calls and the lines run. */
+    if (trace) {
+        Gua_StartTrace();
+    }
+    
     /* Run a script. */
     if (argc > 1) {
         fp = fopen(argv[1], "r");
@@ -255,6 +365,7 @@ int main(int argc, char *argv[], char **env)
         Gua_Free(script);
         
         if (!((status == GUA_OK) || (status == GUA_EXIT))) {
+            Gua_AddStatusMessage(status, error);
             printf("\nError: %s\n", error);
         }
     /* Enter the interactive mode. */
@@ -329,6 +440,7 @@ int main(int argc, char *argv[], char **env)
                     break;
                 }
                 
+                Gua_AddStatusMessage(status, error);
                 printf("\nError: %s", error);
             } else {
                 if (Gua_ObjectType(object) == OBJECT_TYPE_INTEGER) {
@@ -367,6 +479,36 @@ int main(int argc, char *argv[], char **env)
         exitCode = Gua_ObjectToInteger(object);
     }
     
+    /* Write the profiler report, and the samples by call stack for the flame graph tools. */
+    if (profile) {
+        Gua_StopProfile();
+        
+        folded = (Gua_String)Gua_Alloc(sizeof(char) * (strlen(profile) + 8));
+        sprintf(folded, "%s.folded", profile);
+        
+        *error = '\0';
+        if (Gua_WriteProfile(profile, folded, error) != GUA_OK) {
+            printf("\nError: %s\n", error);
+        }
+        
+        Gua_Free(folded);
+    }
+    
+    /* Write the function and line counters. */
+    if (trace) {
+        Gua_StopTrace();
+        
+        *error = '\0';
+        if (Gua_WriteTrace(trace, error) != GUA_OK) {
+            printf("\nError: %s\n", error);
+        }
+    }
+    
+    /* Write the memory statistics. */
+    if (memstats) {
+        Gua_WriteMemoryStatistics(stderr);
+    }
+    
     status = System_Finish(nspace, argc, argv, env, error);
     if (status != GUA_OK) {
         printf("\nError: %s\n", error);
@@ -37,8 +37,6 @@
 #include "sqlite.h"
 #include "sqlite3.h"
 
-#define ERROR_SIZE  65536
-
 #define GUA_SQLITE_FUNCTION_EVAL        0
 #define GUA_SQLITE_FUNCTION_EXECUTE     1
 #define GUA_SQLITE_FUNCTION_EXISTS      2
@@ -97,8 +95,7 @@ int Sqlite_Callback(void *argument, int n, char **value, char **key)
     returnCode = 1;
     
     if (args->function == GUA_SQLITE_FUNCTION_EVAL) {
-        error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-        *error = '\0';
+        error = Gua_AllocErrorBuffer();
         
         status = GUA_OK;
         
@@ -131,25 +128,26 @@ int Sqlite_Callback(void *argument, int n, char **value, char **key)
         }
         
         if (status != GUA_OK) {
+            Gua_AddStatusMessage(status, error);
+            
             args->error = error;
             args->status = status;
             
             return 1;
         }
         
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
         
         return 0;
     } else if (args->function == GUA_SQLITE_FUNCTION_EXECUTE) {
-        error = (Gua_String)Gua_Alloc(sizeof(char) * ERROR_SIZE);
-        *error = '\0';
+        error = Gua_AllocErrorBuffer();
         
         /* Convert SQLite row data to a GuaraScript array. */
         Gua_KeyValuePairsToArray(n, key, value, &array);
         
         /* Prepare the arguments array to be passed to the callback function. */
         argc = 2;
-        argv = (Gua_Object *)Gua_Alloc(sizeof(Gua_Object) * argc);
+        argv = Gua_AllocArguments(argc);
         
         Gua_ClearArguments(argc, argv);
         
@@ -187,13 +185,11 @@ int Sqlite_Callback(void *argument, int n, char **value, char **key)
                 args->error = error;
                 args->status = status;
                 
-                Gua_Free(error);
-                
                 return 1;
             }
         }
         
-        Gua_Free(error);
+        Gua_FreeErrorBuffer(error);
     } else if (args->function == GUA_SQLITE_FUNCTION_EXISTS) {
         if (n > 0) {
             Gua_IntegerToObject(args->object, 1);
@@ -218,10 +214,10 @@ int Sqlite_Callback(void *argument, int n, char **value, char **key)
  *     C
  *
  * Function:
- *     Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Sqlite_SqliteCloseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     SqliteClose function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -234,25 +230,14 @@ int Sqlite_Callback(void *argument, int n, char **value, char **key)
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Sqlite_SqliteCloseFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
     Gua_Handle *h;
     sqlite3 *db;
-    Gua_Short returnCode;
     Gua_String errMessage;
-    Sqlite_CallbackArgs args;
     
     Gua_ClearPObject(object);
     
-    if (argc == 0) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-
-        return GUA_ERROR;
-    }
-
     /**
      * Group:
      *     Scripting
@@ -263,48 +248,64 @@ Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
      * Description:
      *     Closes the database.
      */
-    if (strcmp(Gua_ObjectToString(argv[0]), "sqliteClose") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
 	
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (sqlite3_close(db) != SQLITE_OK) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "could not close database");
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    if (sqlite3_close(db) != SQLITE_OK) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "could not close database");
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_SetHandlePointer((Gua_Handle *)h, NULL);
+        return GUA_ERROR;
+    }
+    
+    Gua_SetHandlePointer((Gua_Handle *)h, NULL);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Sqlite_SqliteEvalFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     SqliteEval function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Sqlite_SqliteEvalFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    sqlite3 *db;
+    Gua_Short returnCode;
+    Gua_String errMessage;
+    Sqlite_CallbackArgs args;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -315,46 +316,33 @@ Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
      * Description:
      *     Executes the specified SQL query and run the defined script for each returned row.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sqliteEval") == 0) {
-        if ((argc < 3) || (argc > 4)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if ((argc < 3) || (argc > 4)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
 
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (argc == 4) {
-            if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-	
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (argc == 4) {
+        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -362,42 +350,89 @@ Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
             
             return GUA_ERROR;
         }
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+	
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
+        return GUA_ERROR;
+    }
+    
+    db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    args.status = GUA_OK;
+    
+    if (argc == 3) {
+        returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, NULL, &errMessage);
+    } else {
+        args.nspace = nspace;
+        args.script = Gua_ObjectToString(argv[3]);
+        args.function = GUA_SQLITE_FUNCTION_EVAL;
+        args.error = NULL;
         args.status = GUA_OK;
         
-        if (argc == 3) {
-            returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, NULL, &errMessage);
-        } else {
-            args.nspace = nspace;
-            args.script = Gua_ObjectToString(argv[3]);
-            args.function = GUA_SQLITE_FUNCTION_EVAL;
-            args.error = NULL;
-            args.status = GUA_OK;
-            
-            returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, &args, &errMessage);
-        }
-        
-        if (args.status != GUA_OK) {
-            strcat(error, args.error);
-            Gua_Free(args.error);
-            
-            if (returnCode != SQLITE_OK) {
-                sqlite3_free(errMessage);
-            }
-            
-            return GUA_ERROR;
-        }
+        returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, &args, &errMessage);
+    }
+    
+    if (args.status != GUA_OK) {
+        strcat(error, args.error);
+        Gua_FreeErrorBuffer(args.error);
         
         if (returnCode != SQLITE_OK) {
-            strcat(error, errMessage);
             sqlite3_free(errMessage);
-            
-            if (returnCode != SQLITE_ABORT) {
-                return GUA_ERROR;
-            }
         }
+        
+        return GUA_ERROR;
+    }
+    
+    if (returnCode != SQLITE_OK) {
+        strcat(error, errMessage);
+        sqlite3_free(errMessage);
+        
+        if (returnCode != SQLITE_ABORT) {
+            return GUA_ERROR;
+        }
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Sqlite_SqliteExecuteFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     SqliteExecute function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Sqlite_SqliteExecuteFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    sqlite3 *db;
+    Gua_Short returnCode;
+    Gua_String errMessage;
+    Sqlite_CallbackArgs args;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -408,46 +443,33 @@ Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
      * Description:
      *     Executes the specified SQL query and call the defined function for each returned row.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sqliteExecute") == 0) {
-        if ((argc < 3) || (argc > 4)) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if ((argc < 3) || (argc > 4)) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
 
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (argc == 4) {
-            if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
-                errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-                sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-                strcat(error, errMessage);
-                Gua_Free(errMessage);
-                
-                return GUA_ERROR;
-            }
-        }
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
-	
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
+        
+        return GUA_ERROR;
+    }
+    if (argc == 4) {
+        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_STRING) {
             errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
             sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
             strcat(error, errMessage);
@@ -455,42 +477,89 @@ Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
             
             return GUA_ERROR;
         }
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+	
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        args.status = GUA_OK;
-        
-        db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        if (argc == 3) {
-            returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, NULL, &errMessage);
-        } else {
-            args.nspace = nspace;
-            args.script = Gua_ObjectToString(argv[3]);
-            args.function = GUA_SQLITE_FUNCTION_EXECUTE;
-            args.error = NULL;
-            args.status = GUA_OK;
-            
-            returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, &args, &errMessage);
-        }
+        return GUA_ERROR;
+    }
+    
+    args.status = GUA_OK;
+    
+    db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    if (argc == 3) {
+        returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, NULL, &errMessage);
+    } else {
+        args.nspace = nspace;
+        args.script = Gua_ObjectToString(argv[3]);
+        args.function = GUA_SQLITE_FUNCTION_EXECUTE;
+        args.error = NULL;
+        args.status = GUA_OK;
         
-        if (args.status != GUA_OK) {
-            strcat(error, args.error);
-            Gua_Free(args.error);
-            
-            if (returnCode != SQLITE_OK) {
-                sqlite3_free(errMessage);
-            }
-            
-            return GUA_ERROR;
-        }
+        returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, &args, &errMessage);
+    }
+    
+    if (args.status != GUA_OK) {
+        strcat(error, args.error);
+        Gua_FreeErrorBuffer(args.error);
         
         if (returnCode != SQLITE_OK) {
-            strcat(error, errMessage);
             sqlite3_free(errMessage);
-            
-            if (returnCode != SQLITE_ABORT) {
-                return GUA_ERROR;
-            }
         }
+        
+        return GUA_ERROR;
+    }
+    
+    if (returnCode != SQLITE_OK) {
+        strcat(error, errMessage);
+        sqlite3_free(errMessage);
+        
+        if (returnCode != SQLITE_ABORT) {
+            return GUA_ERROR;
+        }
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Sqlite_SqliteExistsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     SqliteExists function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Sqlite_SqliteExistsFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    sqlite3 *db;
+    Gua_Short returnCode;
+    Gua_String errMessage;
+    Sqlite_CallbackArgs args;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -501,65 +570,82 @@ Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
      * Description:
      *     Executes the specified SQL query and return 1 if any row is returned.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sqliteExists") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        return GUA_ERROR;
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
 	
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        args.nspace = nspace;
-        args.script = NULL;
-        args.function = GUA_SQLITE_FUNCTION_EXISTS;
-        args.error = NULL;
-        args.status = GUA_OK;
-        
-        Gua_ClearObject(args.object);
-        
-        returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, &args, &errMessage);
-        
-        if (returnCode != SQLITE_OK) {
-            sqlite3_free(errMessage);
-        }
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(args.object) == OBJECT_TYPE_INTEGER) {
-            Gua_LinkToPObject(object, args.object);
-        } else {
-            Gua_IntegerToPObject(object, 0);
-        }
+        return GUA_ERROR;
+    }
+    
+    db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    args.nspace = nspace;
+    args.script = NULL;
+    args.function = GUA_SQLITE_FUNCTION_EXISTS;
+    args.error = NULL;
+    args.status = GUA_OK;
+    
+    Gua_ClearObject(args.object);
+    
+    returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, &args, &errMessage);
+    
+    if (returnCode != SQLITE_OK) {
+        sqlite3_free(errMessage);
+    }
+    
+    if (Gua_ObjectType(args.object) == OBJECT_TYPE_INTEGER) {
+        Gua_LinkToPObject(object, args.object);
+    } else {
+        Gua_IntegerToPObject(object, 0);
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Sqlite_SqliteOneColumnFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     SqliteOneColumn function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Sqlite_SqliteOneColumnFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    sqlite3 *db;
+    Gua_Short returnCode;
+    Gua_String errMessage;
+    Sqlite_CallbackArgs args;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -570,66 +656,81 @@ Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
      * Description:
      *     Executes the specified SQL query but return only the first row.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sqliteOneColumn") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_HANDLE) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_STRING) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
+        return GUA_ERROR;
+    }
+    
+    h = (Gua_Handle *)Gua_ObjectToHandle(argv[1]);
 	
-        if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
-        
-        args.nspace = nspace;
-        args.script = NULL;
-        args.function = GUA_SQLITE_FUNCTION_ONE_COLUMN;
-        args.error = NULL;
-        args.status = GUA_OK;
-        
-        Gua_ClearObject(args.object);
-        
-        returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, &args, &errMessage);
+    if (strcmp((Gua_String)Gua_GetHandleType(h), "Sqlite") != 0) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_LinkToPObject(object, args.object);
+        return GUA_ERROR;
+    }
+    
+    db = (sqlite3 *)Gua_GetHandlePointer((Gua_Handle *)h);
+    
+    args.nspace = nspace;
+    args.script = NULL;
+    args.function = GUA_SQLITE_FUNCTION_ONE_COLUMN;
+    args.error = NULL;
+    args.status = GUA_OK;
+    
+    Gua_ClearObject(args.object);
+    
+    returnCode = sqlite3_exec(db, Gua_ObjectToString(argv[2]), Sqlite_Callback, &args, &errMessage);
+    
+    Gua_LinkToPObject(object, args.object);
+    
+    if (returnCode != SQLITE_OK) {
+        strcat(error, errMessage);
+        sqlite3_free(errMessage);
         
-        if (returnCode != SQLITE_OK) {
-            strcat(error, errMessage);
-            sqlite3_free(errMessage);
-            
-            if (returnCode != SQLITE_ABORT) {
-                return GUA_ERROR;
-            }
+        if (returnCode != SQLITE_ABORT) {
+            return GUA_ERROR;
         }
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Sqlite_SqliteOpenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     SqliteOpen function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Sqlite_SqliteOpenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Handle *h;
+    sqlite3 *db;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
     /**
      * Group:
      *     Scripting
@@ -640,42 +741,33 @@ Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
      * Description:
      *     Opens the specified database file and returns a handle to use it.
      */
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "sqliteOpen") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-
-            return GUA_ERROR;
-        }
-        
-        if (sqlite3_open(Gua_ObjectToString(argv[1]), &db) != SQLITE_OK) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "could not open or create database", Gua_ObjectToString(argv[1]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_NewHandle(h, "Sqlite", db);
+    if (sqlite3_open(Gua_ObjectToString(argv[1]), &db) != SQLITE_OK) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "could not open or create database", Gua_ObjectToString(argv[1]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_HandleToPObject(object, (struct Gua_Handle *)h);
+        return GUA_ERROR;
     }
     
+    Gua_NewHandle(h, "Sqlite", db);
+    
+    Gua_HandleToPObject(object, (struct Gua_Handle *)h);
+    
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Sqlite_Functions[] = {
+    {"sqliteClose", Sqlite_SqliteCloseFunctionWrapper, 2, "h"},
+    {"sqliteEval", Sqlite_SqliteEvalFunctionWrapper, 0, NULL},
+    {"sqliteExecute", Sqlite_SqliteExecuteFunctionWrapper, 0, NULL},
+    {"sqliteExists", Sqlite_SqliteExistsFunctionWrapper, 3, "h"},
+    {"sqliteOneColumn", Sqlite_SqliteOneColumnFunctionWrapper, 3, "h"},
+    {"sqliteOpen", Sqlite_SqliteOpenFunctionWrapper, 2, "s"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -698,53 +790,11 @@ Gua_Status Sqlite_FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
  */
 Gua_Status Sqlite_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
     
     /* Define the function wrapper to each extension function... */
-    Gua_LinkCFunctionToFunction(function, Sqlite_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sqliteClose", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sqliteClose");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Sqlite_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sqliteEval", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sqliteEval");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Sqlite_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sqliteExecute", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sqliteExecute");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Sqlite_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sqliteExists", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sqliteExists");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Sqlite_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sqliteOneColumn", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sqliteOneColumn");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    Gua_LinkCFunctionToFunction(function, Sqlite_FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "sqliteOpen", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "sqliteOpen");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Sqlite_Functions, error);
     
     /**
      * Group:
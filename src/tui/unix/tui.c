@@ -369,10 +369,10 @@ void Tui_Box(int x1, int y1, int x2, int y2, int bordercolor, int backcolor) {
  *     C
  *
  * Function:
- *     Gua_Status Tui_TuiFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Tui_BoxFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Terminal User Interface functions wrapper.
+ *     Box function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -385,300 +385,248 @@ void Tui_Box(int x1, int y1, int x2, int y2, int bordercolor, int backcolor) {
  * Results:
  *     The return object of the wrapped funcion.
  */
-Gua_Status Tui_TuiFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Tui_BoxFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_String buffer;
     Gua_String errMessage;
     
     Gua_ClearPObject(object);
     
-    if (argc == 0) {
+    /* Draw a box on the screen. */
+    if (argc != 7) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
         
         return GUA_ERROR;
     }
     
-    if (strcmp(Gua_ObjectToString(argv[0]), "box") == 0) {
-        /* Draw a box on the screen. */
-        if (argc != 7) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[4]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[5]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[6]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Tui_Box(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2]), Gua_ObjectToInteger(argv[3]), Gua_ObjectToInteger(argv[4]), Gua_ObjectToInteger(argv[5]), Gua_ObjectToInteger(argv[6]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "clreol") == 0) {
-        /* Clear from cursor to the end of line. */
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Tui_Clreol();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "clrscr") == 0) {
-        /* Clear the entire screen. */
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Tui_Clrscr();
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "entry") == 0) {
-        /* Get an entry. */
-        if (argc != 6) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[4]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[5]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        buffer = (Gua_String)Gua_Alloc(sizeof(char) * BUFFER_SIZE);
-        memset(buffer, '\0', BUFFER_SIZE);
-        
-        Tui_Entry(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2]), buffer, Gua_ObjectToInteger(argv[3]), Gua_ObjectToInteger(argv[4]), Gua_ObjectToInteger(argv[5]));
-        
-        Gua_StringToPObject(object, buffer);
-        
-        Gua_Free(buffer);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "getch") == 0) {
-        /*
-         * Return a single character from the standard input, without a buffer.
-         * The character is not echoed to the screen.
-         */
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        buffer = (Gua_String)Gua_Alloc(sizeof(char) * 2);
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        buffer[0] = Tui_Getch();
-        buffer[1] = '\0';
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_StringToPObject(object, buffer);
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_Free(buffer);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "getche") == 0) {
-        /*
-         * Return a single character from the standard input, without a buffer.
-         * The character is echoed to the screen.
-         */
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[4]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        buffer = (Gua_String)Gua_Alloc(sizeof(char) * 2);
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[5]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        buffer[0] = Tui_Getche();
-        buffer[1] = '\0';
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[6]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 6 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_StringToPObject(object, buffer);
-
-        Gua_Free(buffer);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "getkey") == 0) {
-        /*
-         * Return a single character from the standard input, as an integer, without a buffer.
-         * The character is not echoed to the screen.
-         */
-        if (argc != 1) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    Tui_Box(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2]), Gua_ObjectToInteger(argv[3]), Gua_ObjectToInteger(argv[4]), Gua_ObjectToInteger(argv[5]), Gua_ObjectToInteger(argv[6]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Tui_ClreolFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Clreol function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Tui_ClreolFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    /* Clear from cursor to the end of line. */
+    if (argc != 1) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Gua_IntegerToPObject(object, Tui_Getkey());
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "gotoxy") == 0) {
-        /* Clear the entire screen. */
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    Tui_Clreol();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Tui_ClrscrFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Clrscr function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Tui_ClrscrFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    /* Clear the entire screen. */
+    if (argc != 1) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    Tui_Clrscr();
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Tui_EntryFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Entry function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Tui_EntryFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String buffer;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    /* Get an entry. */
+    if (argc != 6) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Tui_Gotoxy((Gua_Short)Gua_ObjectToInteger(argv[1]), (Gua_Short)Gua_ObjectToInteger(argv[2]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "textbackground") == 0) {
-        /* Clear the entire screen. */
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 3 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Tui_Textbackground((Gua_Short)Gua_ObjectToInteger(argv[1]));
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "textcolor") == 0) {
-        /* Clear the entire screen. */
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[4]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 4 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[5]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 5 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        Tui_Textcolor((Gua_Short)Gua_ObjectToInteger(argv[1]));
+        return GUA_ERROR;
     }
     
+    buffer = (Gua_String)Gua_Alloc(sizeof(char) * BUFFER_SIZE);
+    memset(buffer, '\0', BUFFER_SIZE);
+    
+    Tui_Entry(Gua_ObjectToInteger(argv[1]), Gua_ObjectToInteger(argv[2]), buffer, Gua_ObjectToInteger(argv[3]), Gua_ObjectToInteger(argv[4]), Gua_ObjectToInteger(argv[5]));
+    
+    Gua_StringToPObject(object, buffer);
+    
+    Gua_Free(buffer);
+    
     return GUA_OK;
 }
 
@@ -687,89 +635,356 @@ Gua_Status Tui_TuiFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv
  *     C
  *
  * Function:
- *     Gua_Status Tui_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *     Gua_Status Tui_GetchFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Install the Terminal User Interface functions.
+ *     Getch function wrapper.
  *
  * Arguments:
- *     nspace,    a pointer to a structure containing the variable and function namespace;
- *     argc,      the number of command line arguments;
- *     argv,      the command line arguments;
- *     env,       a pointer to the environment variables;
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
  *     error,     a pointer to the error message.
  *
  * Results:
- *     Install the Terminal User Interface functions.
+ *     The return object of the wrapped funcion.
  */
-Gua_Status Tui_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+Gua_Status Tui_GetchFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
-    Gua_Function function;
-    Gua_Object object;
+    Gua_String buffer;
     Gua_String errMessage;
     
-    Gua_LinkCFunctionToFunction(function, Tui_TuiFunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "box", &function) != GUA_OK) {
+    Gua_ClearPObject(object);
+    
+    /*
+     * Return a single character from the standard input, without a buffer.
+     * The character is not echoed to the screen.
+     */
+    if (argc != 1) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "box");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "clreol", &function) != GUA_OK) {
+    
+    buffer = (Gua_String)Gua_Alloc(sizeof(char) * 2);
+    
+    buffer[0] = Tui_Getch();
+    buffer[1] = '\0';
+    
+    Gua_StringToPObject(object, buffer);
+    
+    Gua_Free(buffer);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Tui_GetcheFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Getche function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Tui_GetcheFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String buffer;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    /*
+     * Return a single character from the standard input, without a buffer.
+     * The character is echoed to the screen.
+     */
+    if (argc != 1) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "clreol");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "clrscr", &function) != GUA_OK) {
+    
+    buffer = (Gua_String)Gua_Alloc(sizeof(char) * 2);
+    
+    buffer[0] = Tui_Getche();
+    buffer[1] = '\0';
+    
+    Gua_StringToPObject(object, buffer);
+
+    Gua_Free(buffer);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Tui_GetkeyFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Getkey function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Tui_GetkeyFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    /*
+     * Return a single character from the standard input, as an integer, without a buffer.
+     * The character is not echoed to the screen.
+     */
+    if (argc != 1) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "clrscr");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "entry", &function) != GUA_OK) {
+    
+    Gua_IntegerToPObject(object, Tui_Getkey());
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Tui_GotoxyFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Gotoxy function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Tui_GotoxyFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    /* Clear the entire screen. */
+    if (argc != 3) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "entry");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "getch", &function) != GUA_OK) {
+    
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "getch");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "getche", &function) != GUA_OK) {
+    
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "getche");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 2 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "getkey", &function) != GUA_OK) {
+    
+    Tui_Gotoxy((Gua_Short)Gua_ObjectToInteger(argv[1]), (Gua_Short)Gua_ObjectToInteger(argv[2]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Tui_TextbackgroundFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Textbackground function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Tui_TextbackgroundFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    /* Clear the entire screen. */
+    if (argc != 2) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "getkey");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "gotoxy", &function) != GUA_OK) {
+    
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "gotoxy");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "textbackground", &function) != GUA_OK) {
+    
+    Tui_Textbackground((Gua_Short)Gua_ObjectToInteger(argv[1]));
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Tui_TextcolorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Textcolor function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped funcion.
+ */
+Gua_Status Tui_TextcolorFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    /* Clear the entire screen. */
+    if (argc != 2) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "textbackground");
+        sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "textcolor", &function) != GUA_OK) {
+    
+    if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_INTEGER) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "textcolor");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
+        
+        return GUA_ERROR;
     }
     
+    Tui_Textcolor((Gua_Short)Gua_ObjectToInteger(argv[1]));
+    
+    return GUA_OK;
+}
+
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Tui_Functions[] = {
+    {"box", Tui_BoxFunctionWrapper, 0, NULL},
+    {"clreol", Tui_ClreolFunctionWrapper, 0, NULL},
+    {"clrscr", Tui_ClrscrFunctionWrapper, 0, NULL},
+    {"entry", Tui_EntryFunctionWrapper, 0, NULL},
+    {"getch", Tui_GetchFunctionWrapper, 0, NULL},
+    {"getche", Tui_GetcheFunctionWrapper, 0, NULL},
+    {"getkey", Tui_GetkeyFunctionWrapper, 0, NULL},
+    {"gotoxy", Tui_GotoxyFunctionWrapper, 0, NULL},
+    {"textbackground", Tui_TextbackgroundFunctionWrapper, 0, NULL},
+    {"textcolor", Tui_TextcolorFunctionWrapper, 0, NULL},
+    {NULL, NULL, 0, NULL}
+};
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Tui_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+ *
+ * Description:
+ *     Install the Terminal User Interface functions.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure containing the variable and function namespace;
+ *     argc,      the number of command line arguments;
+ *     argv,      the command line arguments;
+ *     env,       a pointer to the environment variables;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     Install the Terminal User Interface functions.
+ */
+Gua_Status Tui_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
+{
+    Gua_Object object;
+    Gua_String errMessage;
+    
+    Gua_SetFunctions((Gua_Namespace *)nspace, Tui_Functions, error);
+    
     Gua_IntegerToObject(object, TUI_BLACK);
     Gua_SetStoredObject(object);
     if (Gua_SetVariable((Gua_Namespace *)nspace, "BLACK", &object, SCOPE_GLOBAL) != GUA_OK) {
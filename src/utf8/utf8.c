@@ -42,10 +42,10 @@
  *     C
  *
  * Function:
- *     Gua_Status Utf8_Utf8FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *     Gua_Status Utf8_Utf8atFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
  *
  * Description:
- *     Function wrapper.
+ *     Utf8at function wrapper.
  *
  * Arguments:
  *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
@@ -58,317 +58,352 @@
  * Results:
  *     The return object of the wrapped function.
  */
-Gua_Status Utf8_Utf8FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+Gua_Status Utf8_Utf8atFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
 {
     Gua_Integer i;
-    Gua_Integer j;
-    Gua_Integer len;
     Gua_Integer pos;
     Gua_String errMessage;
     
     Gua_ClearPObject(object);
-        
-    if (argc == 0) {
+    
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
         errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s\n", "no function specified");
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
         strcat(error, errMessage);
         Gua_Free(errMessage);
         
         return GUA_ERROR;
     }
     
-    if (strcmp(Gua_ObjectToString(argv[0]), "utf8at") == 0) {
-        if (argc != 3) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_LinkByteArrayToPObject(object, (char *)Gua_Alloc(sizeof(char) * 7), 7);
-        memset(object->string, '\0', sizeof(char) * 7);
-        
-        pos = 0;
-        for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
-            if (pos == Gua_ObjectToInteger(argv[2])) {
-                if ((unsigned char)(argv[1].string[i]) < 0xc0) {
-                    memcpy(object->string, argv[1].string + i, 1);
-                    /* Fix the object length. */
-                    Gua_SetPObjectLength(object, 1);
-                } else if (((unsigned char)(argv[1].string[i]) >= 0xc0) && ((unsigned char)(argv[1].string[i]) < 0xe0)) {
-                    memcpy(object->string, argv[1].string + i, 2);
-                    /* Fix the object length. */
-                    Gua_SetPObjectLength(object, 2);
-                } else if (((unsigned char)(argv[1].string[i]) >= 0xe0) && ((unsigned char)(argv[1].string[i]) < 0xf0)) {
-                    memcpy(object->string, argv[1].string + i, 3);
-                    /* Fix the object length. */
-                    Gua_SetPObjectLength(object, 3);
-                } else if (((unsigned char)(argv[1].string[i]) >= 0xf0) && ((unsigned char)(argv[1].string[i]) < 0xf8)) {
-                    memcpy(object->string, argv[1].string + i, 4);
-                    /* Fix the object length. */
-                    Gua_SetPObjectLength(object, 4);
-                } else if (((unsigned char)(argv[1].string[i]) >= 0xf8) && ((unsigned char)(argv[1].string[i]) < 0xfc)) {
-                    memcpy(object->string, argv[1].string + i, 5);
-                    /* Fix the object length. */
-                    Gua_SetPObjectLength(object, 5);
-                } else if ((unsigned char)(argv[1].string[i]) >= 0xfc) {
-                    memcpy(object->string, argv[1].string + i, 6);
-                    /* Fix the object length. */
-                    Gua_SetPObjectLength(object, 6);
-                }
-                
-                break;
-            }
-            
+    Gua_LinkByteArrayToPObject(object, (char *)Gua_Alloc(sizeof(char) * 7), 7);
+    memset(object->string, '\0', sizeof(char) * 7);
+    
+    pos = 0;
+    for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
+        if (pos == Gua_ObjectToInteger(argv[2])) {
             if ((unsigned char)(argv[1].string[i]) < 0xc0) {
+                memcpy(object->string, argv[1].string + i, 1);
+                /* Fix the object length. */
+                Gua_SetPObjectLength(object, 1);
             } else if (((unsigned char)(argv[1].string[i]) >= 0xc0) && ((unsigned char)(argv[1].string[i]) < 0xe0)) {
-                i++;
+                memcpy(object->string, argv[1].string + i, 2);
+                /* Fix the object length. */
+                Gua_SetPObjectLength(object, 2);
             } else if (((unsigned char)(argv[1].string[i]) >= 0xe0) && ((unsigned char)(argv[1].string[i]) < 0xf0)) {
-                i+=2;
+                memcpy(object->string, argv[1].string + i, 3);
+                /* Fix the object length. */
+                Gua_SetPObjectLength(object, 3);
             } else if (((unsigned char)(argv[1].string[i]) >= 0xf0) && ((unsigned char)(argv[1].string[i]) < 0xf8)) {
-                i+=3;
+                memcpy(object->string, argv[1].string + i, 4);
+                /* Fix the object length. */
+                Gua_SetPObjectLength(object, 4);
             } else if (((unsigned char)(argv[1].string[i]) >= 0xf8) && ((unsigned char)(argv[1].string[i]) < 0xfc)) {
-                i+=4;
+                memcpy(object->string, argv[1].string + i, 5);
+                /* Fix the object length. */
+                Gua_SetPObjectLength(object, 5);
             } else if ((unsigned char)(argv[1].string[i]) >= 0xfc) {
-                i+=5;
+                memcpy(object->string, argv[1].string + i, 6);
+                /* Fix the object length. */
+                Gua_SetPObjectLength(object, 6);
             }
-            pos++;
-        }
-        
-        if (pos != Gua_ObjectToInteger(argv[2])) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %ld...\n", "index out of bound", Gua_ObjectToInteger(argv[2]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "utf8dec") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
             
-            return GUA_ERROR;
+            break;
         }
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_LinkByteArrayToPObject(object, (char *)Gua_Alloc(sizeof(char) * (Gua_ObjectLength(argv[1]) + 1)), Gua_ObjectLength(argv[1]));
-        memset(object->string, '\0', sizeof(char) * (Gua_ObjectLength(argv[1]) + 1));
-        
-        j = 0;
-        for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
-            if ((unsigned char)(argv[1].string[i]) < 0x80) {
-                object->string[j] = argv[1].string[i];
-            } else {
-                object->string[j] = (unsigned char)(((unsigned char)(argv[1].string[i]) << 6) & 0xc0);
-                i++;
-                object->string[j] = (unsigned char)((unsigned char)(object->string[j]) | (unsigned char)((unsigned char)((argv[1].string[i]) & 0x3f)));
-            }
-            j++;
-        }
-        
-        /* Fix the object length. */
-        Gua_SetPObjectLength(object, j);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "utf8enc") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if ((unsigned char)(argv[1].string[i]) < 0xc0) {
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xc0) && ((unsigned char)(argv[1].string[i]) < 0xe0)) {
+            i++;
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xe0) && ((unsigned char)(argv[1].string[i]) < 0xf0)) {
+            i+=2;
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xf0) && ((unsigned char)(argv[1].string[i]) < 0xf8)) {
+            i+=3;
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xf8) && ((unsigned char)(argv[1].string[i]) < 0xfc)) {
+            i+=4;
+        } else if ((unsigned char)(argv[1].string[i]) >= 0xfc) {
+            i+=5;
         }
+        pos++;
+    }
+    
+    if (pos != Gua_ObjectToInteger(argv[2])) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %ld...\n", "index out of bound", Gua_ObjectToInteger(argv[2]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        return GUA_ERROR;
+    }
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Utf8_Utf8decFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Utf8dec function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Utf8_Utf8decFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer i;
+    Gua_Integer j;
+    
+    Gua_ClearPObject(object);
+    
+    Gua_LinkByteArrayToPObject(object, (char *)Gua_Alloc(sizeof(char) * (Gua_ObjectLength(argv[1]) + 1)), Gua_ObjectLength(argv[1]));
+    memset(object->string, '\0', sizeof(char) * (Gua_ObjectLength(argv[1]) + 1));
+    
+    j = 0;
+    for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
+        if ((unsigned char)(argv[1].string[i]) < 0x80) {
+            object->string[j] = argv[1].string[i];
+        } else {
+            object->string[j] = (unsigned char)(((unsigned char)(argv[1].string[i]) << 6) & 0xc0);
+            i++;
+            object->string[j] = (unsigned char)((unsigned char)(object->string[j]) | (unsigned char)((unsigned char)((argv[1].string[i]) & 0x3f)));
         }
-        
-        Gua_LinkByteArrayToPObject(object, (char *)Gua_Alloc(sizeof(char) * (Gua_ObjectLength(argv[1]) * 2 + 1)), Gua_ObjectLength(argv[1]) * 2);
-        memset(object->string, '\0', sizeof(char) * (Gua_ObjectLength(argv[1]) * 2 + 1));
-        
-        j = 0;
-        for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
-            if ((unsigned char)(argv[1].string[i]) < 0x80) {
-                object->string[j] = argv[1].string[i];
-            } else {
-                object->string[j] = (unsigned char)(((unsigned char)(argv[1].string[i]) >> 6) | 0xc0);
-                j++;
-                object->string[j] = (unsigned char)((unsigned char)((argv[1].string[i]) & 0x3f) | 0x80);
-            }
+        j++;
+    }
+    
+    /* Fix the object length. */
+    Gua_SetPObjectLength(object, j);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Utf8_Utf8encFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Utf8enc function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Utf8_Utf8encFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer i;
+    Gua_Integer j;
+    
+    Gua_ClearPObject(object);
+    
+    Gua_LinkByteArrayToPObject(object, (char *)Gua_Alloc(sizeof(char) * (Gua_ObjectLength(argv[1]) * 2 + 1)), Gua_ObjectLength(argv[1]) * 2);
+    memset(object->string, '\0', sizeof(char) * (Gua_ObjectLength(argv[1]) * 2 + 1));
+    
+    j = 0;
+    for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
+        if ((unsigned char)(argv[1].string[i]) < 0x80) {
+            object->string[j] = argv[1].string[i];
+        } else {
+            object->string[j] = (unsigned char)(((unsigned char)(argv[1].string[i]) >> 6) | 0xc0);
             j++;
+            object->string[j] = (unsigned char)((unsigned char)((argv[1].string[i]) & 0x3f) | 0x80);
         }
-        
-        /* Fix the object length. */
-        Gua_SetPObjectLength(object, j);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "utf8len") == 0) {
-        if (argc != 2) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        j++;
+    }
+    
+    /* Fix the object length. */
+    Gua_SetPObjectLength(object, j);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Utf8_Utf8lenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Utf8len function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Utf8_Utf8lenFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer i;
+    Gua_Integer len;
+    
+    Gua_ClearPObject(object);
+    
+    len = 0;
+    for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
+        if ((unsigned char)(argv[1].string[i]) < 0xc0) {
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xc0) && ((unsigned char)(argv[1].string[i]) < 0xe0)) {
+            i++;
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xe0) && ((unsigned char)(argv[1].string[i]) < 0xf0)) {
+            i+=2;
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xf0) && ((unsigned char)(argv[1].string[i]) < 0xf8)) {
+            i+=3;
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xf8) && ((unsigned char)(argv[1].string[i]) < 0xfc)) {
+            i+=4;
+        } else if ((unsigned char)(argv[1].string[i]) >= 0xfc) {
+            i+=5;
         }
+        len++;
+    }
+    
+    Gua_IntegerToPObject(object, len);
+    
+    return GUA_OK;
+}
+
+/**
+ * Group:
+ *     C
+ *
+ * Function:
+ *     Gua_Status Utf8_Utf8rangeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+ *
+ * Description:
+ *     Utf8range function wrapper.
+ *
+ * Arguments:
+ *     nspace,    a pointer to a structure Gua_Namespace. Must do a cast before use it;
+ *     argc,      the number of arguments to pass to the function;
+ *     argv,      an array containing the arguments to the function;
+ *                argv[0] is the function name;
+ *     object,    a structure containing the return object of the function;
+ *     error,     a pointer to the error message.
+ *
+ * Results:
+ *     The return object of the wrapped function.
+ */
+Gua_Status Utf8_Utf8rangeFunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *argv, Gua_Object *object, Gua_String error)
+{
+    Gua_Integer i;
+    Gua_Integer j;
+    Gua_Integer pos;
+    Gua_String errMessage;
+    
+    Gua_ClearPObject(object);
+    
+    if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
+    }
+    if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        len = 0;
-        for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
+        return GUA_ERROR;
+    }
+    
+    Gua_LinkByteArrayToPObject(object, (char *)Gua_Alloc(sizeof(char) * (Gua_ObjectLength(argv[1]) * 2 + 1)), Gua_ObjectLength(argv[1]) * 2);
+    memset(object->string, '\0', sizeof(char) * (Gua_ObjectLength(argv[1]) * 2 + 1));
+    
+    pos = 0;
+    j = 0;
+    for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
+        if ((pos >= Gua_ObjectToInteger(argv[2])) && (pos <= Gua_ObjectToInteger(argv[3]))) {
             if ((unsigned char)(argv[1].string[i]) < 0xc0) {
+                memcpy(object->string + j, argv[1].string + i, 1);
+                j+=1;
             } else if (((unsigned char)(argv[1].string[i]) >= 0xc0) && ((unsigned char)(argv[1].string[i]) < 0xe0)) {
-                i++;
+                memcpy(object->string + j, argv[1].string + i, 2);
+                j+=2;
             } else if (((unsigned char)(argv[1].string[i]) >= 0xe0) && ((unsigned char)(argv[1].string[i]) < 0xf0)) {
-                i+=2;
+                memcpy(object->string + j, argv[1].string + i, 3);
+                j+=3;
             } else if (((unsigned char)(argv[1].string[i]) >= 0xf0) && ((unsigned char)(argv[1].string[i]) < 0xf8)) {
-                i+=3;
+                memcpy(object->string + j, argv[1].string + i, 4);
+                j+=4;
             } else if (((unsigned char)(argv[1].string[i]) >= 0xf8) && ((unsigned char)(argv[1].string[i]) < 0xfc)) {
-                i+=4;
+                memcpy(object->string + j, argv[1].string + i, 5);
+                j+=5;
             } else if ((unsigned char)(argv[1].string[i]) >= 0xfc) {
-                i+=5;
+                memcpy(object->string + j, argv[1].string + i, 6);
+                j+=6;
             }
-            len++;
         }
         
-        Gua_IntegerToPObject(object, len);
-    } else if (strcmp(Gua_ObjectToString(argv[0]), "utf8range") == 0) {
-        if (argc != 4) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "wrong number of arguments for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if (pos == Gua_ObjectToInteger(argv[3])) {
+            break;
         }
         
-        if (Gua_ObjectType(argv[1]) != OBJECT_TYPE_STRING) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        if (Gua_ObjectType(argv[2]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
+        if ((unsigned char)(argv[1].string[i]) < 0xc0) {
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xc0) && ((unsigned char)(argv[1].string[i]) < 0xe0)) {
+            i++;
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xe0) && ((unsigned char)(argv[1].string[i]) < 0xf0)) {
+            i+=2;
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xf0) && ((unsigned char)(argv[1].string[i]) < 0xf8)) {
+            i+=3;
+        } else if (((unsigned char)(argv[1].string[i]) >= 0xf8) && ((unsigned char)(argv[1].string[i]) < 0xfc)) {
+            i+=4;
+        } else if ((unsigned char)(argv[1].string[i]) >= 0xfc) {
+            i+=5;
         }
-        if (Gua_ObjectType(argv[3]) != OBJECT_TYPE_INTEGER) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %-.20s...\n", "illegal argument 1 for function", Gua_ObjectToString(argv[0]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
-        
-        Gua_LinkByteArrayToPObject(object, (char *)Gua_Alloc(sizeof(char) * (Gua_ObjectLength(argv[1]) * 2 + 1)), Gua_ObjectLength(argv[1]) * 2);
-        memset(object->string, '\0', sizeof(char) * (Gua_ObjectLength(argv[1]) * 2 + 1));
-        
-        pos = 0;
-        j = 0;
-        for (i = 0; i < Gua_ObjectLength(argv[1]); i++) {
-            if ((pos >= Gua_ObjectToInteger(argv[2])) && (pos <= Gua_ObjectToInteger(argv[3]))) {
-                if ((unsigned char)(argv[1].string[i]) < 0xc0) {
-                    memcpy(object->string + j, argv[1].string + i, 1);
-                    j+=1;
-                } else if (((unsigned char)(argv[1].string[i]) >= 0xc0) && ((unsigned char)(argv[1].string[i]) < 0xe0)) {
-                    memcpy(object->string + j, argv[1].string + i, 2);
-                    j+=2;
-                } else if (((unsigned char)(argv[1].string[i]) >= 0xe0) && ((unsigned char)(argv[1].string[i]) < 0xf0)) {
-                    memcpy(object->string + j, argv[1].string + i, 3);
-                    j+=3;
-                } else if (((unsigned char)(argv[1].string[i]) >= 0xf0) && ((unsigned char)(argv[1].string[i]) < 0xf8)) {
-                    memcpy(object->string + j, argv[1].string + i, 4);
-                    j+=4;
-                } else if (((unsigned char)(argv[1].string[i]) >= 0xf8) && ((unsigned char)(argv[1].string[i]) < 0xfc)) {
-                    memcpy(object->string + j, argv[1].string + i, 5);
-                    j+=5;
-                } else if ((unsigned char)(argv[1].string[i]) >= 0xfc) {
-                    memcpy(object->string + j, argv[1].string + i, 6);
-                    j+=6;
-                }
-            }
-            
-            if (pos == Gua_ObjectToInteger(argv[3])) {
-                break;
-            }
-            
-            if ((unsigned char)(argv[1].string[i]) < 0xc0) {
-            } else if (((unsigned char)(argv[1].string[i]) >= 0xc0) && ((unsigned char)(argv[1].string[i]) < 0xe0)) {
-                i++;
-            } else if (((unsigned char)(argv[1].string[i]) >= 0xe0) && ((unsigned char)(argv[1].string[i]) < 0xf0)) {
-                i+=2;
-            } else if (((unsigned char)(argv[1].string[i]) >= 0xf0) && ((unsigned char)(argv[1].string[i]) < 0xf8)) {
-                i+=3;
-            } else if (((unsigned char)(argv[1].string[i]) >= 0xf8) && ((unsigned char)(argv[1].string[i]) < 0xfc)) {
-                i+=4;
-            } else if ((unsigned char)(argv[1].string[i]) >= 0xfc) {
-                i+=5;
-            }
-            pos++;
-        }
-        
-        /* Fix the object length. */
-        Gua_SetPObjectLength(object, j);
+        pos++;
+    }
+    
+    /* Fix the object length. */
+    Gua_SetPObjectLength(object, j);
+    
+    if (pos > Gua_ObjectToInteger(argv[3])) {
+        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
+        sprintf(errMessage, "%s %ld...\n", "index out of bound", Gua_ObjectToInteger(argv[2]));
+        strcat(error, errMessage);
+        Gua_Free(errMessage);
         
-        if (pos > Gua_ObjectToInteger(argv[3])) {
-            errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-            sprintf(errMessage, "%s %ld...\n", "index out of bound", Gua_ObjectToInteger(argv[2]));
-            strcat(error, errMessage);
-            Gua_Free(errMessage);
-            
-            return GUA_ERROR;
-        }
+        return GUA_ERROR;
     }
     
     return GUA_OK;
 }
 
+/* The script functions, with the number and the type of their arguments. */
+static Gua_FunctionEntry Utf8_Functions[] = {
+    {"utf8at", Utf8_Utf8atFunctionWrapper, 3, "s"},
+    {"utf8dec", Utf8_Utf8decFunctionWrapper, 2, "s"},
+    {"utf8enc", Utf8_Utf8encFunctionWrapper, 2, "s"},
+    {"utf8len", Utf8_Utf8lenFunctionWrapper, 2, "s"},
+    {"utf8range", Utf8_Utf8rangeFunctionWrapper, 4, "s"},
+    {NULL, NULL, 0, NULL}
+};
+
 /**
  * Group:
  *     C
@@ -391,41 +426,10 @@ Gua_Status Utf8_Utf8FunctionWrapper(void *nspace, Gua_Short argc, Gua_Object *ar
  */
 Gua_Status Utf8_Init(void *nspace, int argc, char *argv[], char **env, Gua_String error)
 {
-    Gua_Function function;
     Gua_Object object;
     Gua_String errMessage;
     
-    Gua_LinkCFunctionToFunction(function, Utf8_Utf8FunctionWrapper);
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "utf8at", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "utf8at");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "utf8dec", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "utf8dec");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "utf8enc", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "utf8enc");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "utf8len", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "utf8len");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
-    if (Gua_SetFunction((Gua_Namespace *)nspace, "utf8range", &function) != GUA_OK) {
-        errMessage = (Gua_String) Gua_Alloc(sizeof(char) * MAX_ERROR_MSG_SIZE + 1);
-        sprintf(errMessage, "%s %-.20s...\n", "can't set function", "utf8range");
-        strcat(error, errMessage);
-        Gua_Free(errMessage);
-    }
+    Gua_SetFunctions((Gua_Namespace *)nspace, Utf8_Functions, error);
     
     /**
      * Group: